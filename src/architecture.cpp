@@ -7,26 +7,33 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
+#include <sstream>
+#include <string>
 
+#include "coverage.h"
+#include "decoder.h"
+#include "descriptors.h"
 #include "flags.h"
+#include "info.h"
+#include "instrument.h"
 #include "instructions.h"
+#include "platform.h"
 #include "registers.h"
 #include "sizes.h"
 #include "text.h"
+#include "trace.h"
 #include "util.h"
+#include "view.h"
 
 namespace BN = BinaryNinja;
 
 namespace HCS08 {
+// Instruction lookup uses the process-wide, constant-initialized
+// INSTRUCTION_TABLE and descriptor pages, so there is nothing to build here
 HCS08Architecture::HCS08Architecture(const std::string& name)
-    : Architecture(name) {
-  // The INSTRUCTIONS map contains a map of opcode -> Instruction objects for
-  // fast lookup in Info/Text/Lift methods
-  INSTRUCTIONS = GenerateInstructionMap();
-}
+    : Architecture(name) {}
 
-HCS08Architecture::~HCS08Architecture() { INSTRUCTIONS.clear(); }
+HCS08Architecture::~HCS08Architecture() = default;
 
 BNRegisterInfo HCS08Architecture::RegisterInfo(const uint32_t fullWidthReg,
                                                const size_t offset,
@@ -227,12 +234,34 @@ HCS08Architecture::GetFlagsRequiredForFlagCondition(
   }
 }
 
+/**
+ * Describe looks up the descriptor of the instruction at data. Text and Lift
+ * need nothing else, so only Info goes on to decode the operands.
+ * @param data   - pointer to the next byte in the binary that is being
+ * analyzed
+ * @param maxLen - number of readable bytes at data
+ * @return the descriptor, or nullptr for an undefined opcode or an
+ * instruction cut off by the end of the buffer
+ */
+const InstructionDescriptor* HCS08Architecture::Describe(const uint8_t* data,
+                                                         const size_t maxLen) {
+  size_t needed;
+  const InstructionDescriptor* descriptor =
+      DecodeDescriptor(data, maxLen, needed);
+  if (descriptor == nullptr) {
+    Instrument::RecordFailure(
+        needed > 0 ? Instrument::Failure::TRUNCATED
+                   : Instrument::Failure::UNDEFINED_OPCODE);
+  }
+  return descriptor;
+}
+
 /**
  * GetInstructionInfo parses opcode; determines instruction length and
  * branching behavior
  * @param data   - pointer to the next byte in the binary that is being analyzed
  * @param addr   - current address value held by the program counter
- * @param maxLen - max instruction length
+ * @param maxLen - number of readable bytes at data
  * @param result - InstructionInfo object to be populated with instruction
  * length and branch behavior
  * @return bool indicating whether a valid instruction was parsed
@@ -241,17 +270,24 @@ bool HCS08Architecture::GetInstructionInfo(const uint8_t* data,
                                            const uint64_t addr,
                                            const size_t maxLen,
                                            BN::InstructionInfo& result) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS)) {
-    return i->get()->Info(data, addr, result);
+  Instrument::CallTimer timer(Instrument::Callback::INFO);
+  const InstructionDescriptor* descriptor = Describe(data, maxLen);
+  if (descriptor == nullptr) {
+    return false;
   }
-  return false;
+  timer.SetOpcode(*descriptor);
+  DecodedInstruction decoded;
+  DecodeFromDescriptor(*descriptor, data, addr, decoded);
+  InfoFromDecoded(decoded, result);
+  return true;
 }
 
 /**
  * GetInstructionText parses opcode; generates disassembly text
  * @param data   - pointer to the next byte in the binary that is being analyzed
  * @param addr   - current address value held by the program counter
- * @param len - length of the instruction (set by this function call)
+ * @param len - number of readable bytes at data; set to the length of the
+ * instruction
  * @param result - InstructionTextToken vector to be populated with instruction
  * text
  * @return bool indicating whether a valid instruction was parsed
@@ -259,38 +295,130 @@ bool HCS08Architecture::GetInstructionInfo(const uint8_t* data,
 bool HCS08Architecture::GetInstructionText(
     const uint8_t* data, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS)) {
-    len = i->get()->GetLength();
-    return i->get()->Text(data, addr, len, result);
+  Instrument::CallTimer timer(Instrument::Callback::TEXT);
+  const InstructionDescriptor* descriptor = Describe(data, len);
+  if (descriptor == nullptr) {
+    return false;
   }
-  return false;
+  timer.SetOpcode(*descriptor);
+  len = descriptor->length;
+  if (!TextFromDescriptor(*descriptor, data, result)) {
+    Instrument::RecordFailure(Instrument::Failure::TEXT);
+    return false;
+  }
+  return true;
 }
 
 /**
  * GetInstructionLowLevelIL parses opcode; generates binja LLIL
  * @param data   - pointer to the next byte in the binary that is being analyzed
  * @param addr   - current address value held by the program counter
- * @param len - length of the instruction (set by this function call)
+ * @param len - number of readable bytes at data; set to the length of the
+ * instruction
  * @param il - LowLevelILFunction object used to generate the LLIL
  * @return bool indicating whether a valid instruction was parsed
  */
 bool HCS08Architecture::GetInstructionLowLevelIL(const uint8_t* data,
                                                  uint64_t addr, size_t& len,
                                                  BN::LowLevelILFunction& il) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS)) {
-    return i->get()->Lift(data, addr, len, il, this);
+  Instrument::CallTimer timer(Instrument::Callback::LIFT);
+  const InstructionDescriptor* descriptor = Describe(data, len);
+  if (descriptor == nullptr) {
+    return false;
   }
-  return false;
+  timer.SetOpcode(*descriptor);
+  if (!LookupInstruction(*descriptor)->Lift(data, addr, len, il, this)) {
+    Instrument::RecordFailure(Instrument::Failure::LIFT);
+    return false;
+  }
+  return true;
 }
 
+namespace {
+/**
+ * IsHCS08View - Check that a view is analyzed as HCS08 code, so commands
+ * that read the vector table or apply HCS08 traces leave other views alone
+ * @param view - view a plugin command was invoked on
+ * @return whether the view's default architecture is hcs08
+ */
+bool IsHCS08View(BN::BinaryView* view) {
+  const BN::Ref<BN::Architecture> arch = view->GetDefaultArchitecture();
+  return arch && arch->GetName() == "hcs08";
+}
+}  // namespace
 }  // namespace HCS08
 extern "C" {
 BN_DECLARE_CORE_ABI_VERSION
 BINARYNINJAPLUGIN bool CorePluginInit() {
   BN::Architecture* hcs08 = new HCS08::HCS08Architecture("hcs08");
   BN::Architecture::Register(hcs08);
+  HCS08::RegisterPlatform(hcs08);
+  BN::BinaryViewType::Register(new HCS08::HexImageViewType());
+
+  // Hex files get their vectors at load time; this covers raw binaries
+  BN::PluginCommand::Register(
+      "HCS08\\Define Interrupt Vector Functions",
+      "Create functions for the reset, SWI, IRQ and peripheral handlers in "
+      "the vector table at $FFC0-$FFFF",
+      [](BN::BinaryView* view) {
+        if (!HCS08::IsHCS08View(view)) {
+          BN::LogError("Vector functions can only be defined in HCS08 views");
+          return;
+        }
+        const BN::Ref<BN::Platform> platform = view->GetDefaultPlatform();
+        if (!platform) {
+          BN::LogError("Set a platform before defining vector functions");
+          return;
+        }
+        HCS08::DefineVectorFunctions(*view, platform,
+                                     HCS08::ReadVectorTable(*view));
+      },
+      HCS08::IsHCS08View);
 
-  // TODO: define and add a calling convention
+  // Trace files are mapped rather than read, and counted per address before
+  // any Binary Ninja call, so long traces cost one pass over the file
+  BN::PluginCommand::Register(
+      "HCS08\\Import Execution Trace",
+      "Highlight the basic blocks run in an HCS08 trace file, shaded by how "
+      "often each ran",
+      [](BN::BinaryView* view) {
+        if (!HCS08::IsHCS08View(view)) {
+          BN::LogError("Traces can only be imported into HCS08 views");
+          return;
+        }
+        std::string path;
+        if (!BN::GetOpenFileNameInput(path, "HCS08 trace file", "*.trace")) {
+          return;
+        }
+        HCS08::MappedFile file;
+        HCS08::TraceCoverage coverage;
+        if (!file.Open(path) ||
+            !HCS08::CountTraceHits(file.Data(), file.Size(), coverage)) {
+          BN::LogError("%s is not a valid HCS08 trace", path.c_str());
+          return;
+        }
+        HCS08::IntervalHits hits;
+        const size_t blocks = HCS08::ApplyTraceCoverage(*view, coverage, hits);
+        BN::LogInfo(
+            "%s: %llu steps, %zu blocks highlighted by how often their "
+            "first instruction ran; %llu steps at %llu addresses outside any "
+            "function",
+            path.c_str(), static_cast<unsigned long long>(coverage.steps),
+            blocks, static_cast<unsigned long long>(hits.unmapped),
+            static_cast<unsigned long long>(hits.unmappedAddresses));
+      },
+      HCS08::IsHCS08View);
+
+  if constexpr (HCS08::Instrument::ENABLED) {
+    BN::PluginCommand::Register(
+        "HCS08\\Dump Instrumentation Counters",
+        "Log per-opcode callback counts, latency and decode failures",
+        [](BN::BinaryView*) {
+          std::ostringstream report;
+          HCS08::Instrument::Dump(report);
+          BN::LogInfo("%s", report.str().c_str());
+        });
+  }
 
   return true;
 }
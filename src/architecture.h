@@ -6,6 +6,7 @@
 
 #include <binaryninjaapi.h>
 
+#include "descriptors.h"
 #include "instructions.h"
 
 namespace BN = BinaryNinja;
@@ -16,8 +17,8 @@ class HCS08Architecture : public BN::Architecture {
   static BNRegisterInfo RegisterInfo(uint32_t fullWidthReg, size_t offset,
                                      size_t size, bool zeroExtend = false);
 
-  std::unordered_map<uint16_t, std::optional<std::shared_ptr<Instruction>>>
-      INSTRUCTIONS;
+  static const InstructionDescriptor* Describe(const uint8_t* data,
+                                               size_t maxLen);
 
  public:
   explicit HCS08Architecture(const std::string& name);
@@ -0,0 +1,216 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <binaryninjaapi.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+#include "architecture.h"
+#include "instructions.h"
+#include "opcodes.h"
+
+namespace BN = BinaryNinja;
+
+/*
+ * This binary replaces the global operator new/delete so every C++ heap
+ * allocation made by the plugin is counted while a measurement is active.
+ * Allocations made by malloc directly (or inside the Binary Ninja core) are
+ * not seen; the plugin itself only allocates through operator new.
+ */
+namespace {
+std::atomic<bool> COUNTING = false;
+std::atomic<size_t> ALLOCATIONS = 0;
+
+void* Allocate(const size_t size, const size_t alignment = 0) {
+  if (COUNTING.load(std::memory_order_relaxed)) {
+    ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  }
+  const size_t bytes = std::max<size_t>(size, 1);
+  if (alignment == 0) {
+    return std::malloc(bytes);
+  }
+#ifdef _MSC_VER
+  // MSVC has no std::aligned_alloc; its aligned blocks need _aligned_free
+  return _aligned_malloc(bytes, alignment);
+#else
+  return std::aligned_alloc(alignment,
+                            (bytes + alignment - 1) / alignment * alignment);
+#endif
+}
+
+// Release memory from the aligned operator new overloads
+void FreeAligned(void* ptr) {
+#ifdef _MSC_VER
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+void* AllocateOrThrow(const size_t size, const size_t alignment = 0) {
+  void* ptr = Allocate(size, alignment);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+// Number of operator new calls made by f
+template <typename F>
+size_t CountAllocations(F&& f) {
+  ALLOCATIONS = 0;
+  COUNTING = true;
+  f();
+  COUNTING = false;
+  return ALLOCATIONS;
+}
+
+// Opcode followed by fixed operand bytes, padded to the longest instruction
+std::array<uint8_t, 4> Encode(const uint16_t opcode) {
+  std::array<uint8_t, 4> bytes = {0x00, 0x12, 0x34, 0x56};
+  if ((opcode & 0xFF00) >> 8 == HCS08::OpcodeFields::EXT_OP) {
+    bytes[0] = HCS08::OpcodeFields::EXT_OP;
+    bytes[1] = opcode & 0xFF;
+  } else {
+    bytes[0] = opcode & 0xFF;
+  }
+  return bytes;
+}
+}  // namespace
+
+void* operator new(const size_t size) { return AllocateOrThrow(size); }
+void* operator new[](const size_t size) { return AllocateOrThrow(size); }
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+  return Allocate(size);
+}
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept {
+  return Allocate(size);
+}
+void* operator new(const size_t size, const std::align_val_t alignment) {
+  return AllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+  return AllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+
+// Test the allocation budget of each callback for every opcode
+class TestAllocationAllInstructions : public ::testing::TestWithParam<int> {
+ protected:
+  void SetUp() override {
+    arch = std::make_unique<HCS08::HCS08Architecture>("hcs08alloc");
+
+    // Run each callback once so lazy one-time setup, such as the per-thread
+    // counters of an instrumented build, is not charged to the first test
+    BN::InstructionInfo info;
+    arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(), info);
+    std::vector<BN::InstructionTextToken> tokens;
+    size_t len = bytes.size();
+    arch->GetInstructionText(bytes.data(), 0x1000, len, tokens);
+    BN::Ref<BN::LowLevelILFunction> il =
+        new BN::LowLevelILFunction(arch.get());
+    len = bytes.size();
+    arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, *il);
+  }
+
+  const std::array<uint8_t, 4> bytes = Encode(GetParam());
+  std::unique_ptr<HCS08::HCS08Architecture> arch;
+};
+
+// Info must not allocate
+TEST_P(TestAllocationAllInstructions, TestInfo) {
+  BN::InstructionInfo result;
+  EXPECT_EQ(CountAllocations([&] {
+              arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(),
+                                       result);
+            }),
+            0);
+}
+
+// Text may only grow the token vector, which it does at most once
+TEST_P(TestAllocationAllInstructions, TestText) {
+  std::vector<BN::InstructionTextToken> result;
+  size_t len = bytes.size();
+  EXPECT_LE(CountAllocations([&] {
+              arch->GetInstructionText(bytes.data(), 0x1000, len, result);
+            }),
+            1);
+
+  // Token strings fit the small string buffer, so a vector with room for the
+  // tokens needs no allocation at all
+  const size_t count = result.size();
+  result.clear();
+  len = bytes.size();
+  EXPECT_EQ(CountAllocations([&] {
+              arch->GetInstructionText(bytes.data(), 0x1000, len, result);
+            }),
+            0);
+  EXPECT_EQ(result.size(), count);
+}
+
+// Lift may allocate only what building the IL itself costs; decoding and
+// dispatch in front of Instruction::Lift must not add any allocation
+TEST_P(TestAllocationAllInstructions, TestLift) {
+  BN::Ref<BN::LowLevelILFunction> callbackIl =
+      new BN::LowLevelILFunction(arch.get());
+  BN::Ref<BN::LowLevelILFunction> directIl =
+      new BN::LowLevelILFunction(arch.get());
+  HCS08::Instruction* instruction = HCS08::DecodeInstruction(bytes.data());
+  ASSERT_NE(instruction, nullptr);
+
+  size_t len = bytes.size();
+  const size_t direct = CountAllocations([&] {
+    instruction->Lift(bytes.data(), 0x1000, len, *directIl, arch.get());
+  });
+  len = bytes.size();
+  EXPECT_EQ(CountAllocations([&] {
+              arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len,
+                                             *callbackIl);
+            }),
+            direct);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TestAll, TestAllocationAllInstructions,
+    ::testing::ValuesIn(HCS08::Opcodes::GetAllOpcodes()),
+    [](const testing::TestParamInfo<TestAllocationAllInstructions::ParamType>&
+           info) {
+      auto op = HCS08::Opcodes::NAMES.at(info.param);
+
+      // Sanitize instruction name for printing
+      op.erase(std::remove_if(op.begin(), op.end(),
+                              [](char c) { return c == '/' || c == '.'; }),
+               op.end());
+
+      // append the opcode to keep test names unique
+      return "OP_" + op + "_" + std::to_string(info.param);
+    });
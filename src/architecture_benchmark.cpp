@@ -0,0 +1,383 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <benchmark/benchmark.h>
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "architecture.h"
+#include "corpus.h"
+#include "descriptors.h"
+#include "opcodes.h"
+#include "render.h"
+#include "simulator.h"
+#include "sweep.h"
+#include "trace.h"
+
+namespace BN = BinaryNinja;
+
+namespace {
+constexpr uint64_t BASE_ADDRESS = 0x8000;
+
+// Size of the generated instruction streams, roughly one flash page
+constexpr size_t STREAM_SIZE = 4096;
+
+// Instructions lifted into one LowLevelILFunction before it is replaced
+constexpr size_t LIFT_BATCH = 64;
+
+// Instructions simulated per benchmark iteration
+constexpr uint64_t SIMULATE_BATCH = 1 << 20;
+
+// Steps in the trace counted per benchmark iteration
+constexpr uint64_t TRACE_STEPS = 1 << 22;
+
+// Printable names of AddressingMode, in declaration order
+constexpr const char* MODE_NAMES[] = {
+    "INH",         "IMM",           "IMM16",           "DIR",
+    "EXT",         "IX",            "IX1",             "IX2",
+    "SP1",         "SP2",           "REL",             "BIT_DIR",
+    "BIT_DIR_REL", "IMM_REL",       "DIR_REL",         "INH_REL",
+    "IX_REL",      "IX1_REL",       "IX_POSTINC_REL",  "IX1_POSTINC_REL",
+    "SP1_REL",     "DIR_DIR",       "DIR_IX_POSTINC",  "IMM_DIR",
+    "IX_POSTINC_DIR"};
+
+// Encode an opcode from Opcodes::GetAllOpcodes() followed by fixed operand
+// bytes, padded to the longest instruction
+std::array<uint8_t, 4> Encode(const int opcode) {
+  std::array<uint8_t, 4> bytes = {0x00, 0x12, 0x34, 0x56};
+  if ((opcode & 0xFF00) >> 8 == HCS08::OpcodeFields::EXT_OP) {
+    bytes[0] = HCS08::OpcodeFields::EXT_OP;
+    bytes[1] = opcode & 0xFF;
+  } else {
+    bytes[0] = opcode & 0xFF;
+  }
+  return bytes;
+}
+
+const HCS08::InstructionDescriptor& Describe(const int opcode) {
+  return *HCS08::LookupDescriptor(Encode(opcode).data());
+}
+
+std::vector<int> OpcodesForMode(const HCS08::AddressingMode mode) {
+  std::vector<int> opcodes;
+  for (const int opcode : HCS08::Opcodes::GetAllOpcodes()) {
+    if (Describe(opcode).mode == mode) {
+      opcodes.push_back(opcode);
+    }
+  }
+  return opcodes;
+}
+
+const std::vector<uint8_t>& Stream(const int64_t weighted) {
+  static const std::vector<uint8_t> UNIFORM = HCS08::GenerateCorpus(
+      {HCS08::UniformProfile(), 0x08, STREAM_SIZE, BASE_ADDRESS});
+  static const std::vector<uint8_t> FIRMWARE = HCS08::GenerateCorpus(
+      {HCS08::FirmwareProfile(), 0x08, STREAM_SIZE, BASE_ADDRESS});
+  return weighted ? FIRMWARE : UNIFORM;
+}
+
+void AllOpcodes(benchmark::internal::Benchmark* b) {
+  for (const int opcode : HCS08::Opcodes::GetAllOpcodes()) {
+    b->Arg(opcode);
+  }
+}
+
+void AllModes(benchmark::internal::Benchmark* b) {
+  for (size_t mode = 0; mode < std::size(MODE_NAMES); mode++) {
+    b->Arg(static_cast<int64_t>(mode));
+  }
+}
+
+void AllStreams(benchmark::internal::Benchmark* b) {
+  b->ArgName("firmware")->Arg(0)->Arg(1);
+}
+
+/*
+ * Each call decodes, renders or lifts one instruction and returns its length.
+ * Calls are constructed once per benchmark so reusable buffers stay warm.
+ */
+class InfoCall {
+ public:
+  InfoCall(HCS08::HCS08Architecture& arch, benchmark::State&) : ARCH(arch) {}
+
+  size_t Run(const uint8_t* data, uint64_t addr, size_t available) {
+    BN::InstructionInfo result;
+    ARCH.GetInstructionInfo(data, addr, available, result);
+    benchmark::DoNotOptimize(result);
+    return result.length;
+  }
+
+ private:
+  HCS08::HCS08Architecture& ARCH;
+};
+
+class TextCall {
+ public:
+  TextCall(HCS08::HCS08Architecture& arch, benchmark::State&) : ARCH(arch) {}
+
+  size_t Run(const uint8_t* data, uint64_t addr, size_t available) {
+    TOKENS.clear();
+    size_t len = available;
+    ARCH.GetInstructionText(data, addr, len, TOKENS);
+    benchmark::DoNotOptimize(TOKENS.data());
+    return len;
+  }
+
+ private:
+  HCS08::HCS08Architecture& ARCH;
+  std::vector<BN::InstructionTextToken> TOKENS;
+};
+
+/*
+ * Lifting appends to a LowLevelILFunction, so each batch of LIFT_BATCH
+ * instructions gets a fresh function created outside the timed region.
+ */
+class LiftCall {
+ public:
+  LiftCall(HCS08::HCS08Architecture& arch, benchmark::State& state)
+      : ARCH(arch), STATE(state) {}
+
+  size_t Run(const uint8_t* data, uint64_t addr, size_t available) {
+    if (!IL || LIFTED == LIFT_BATCH) {
+      STATE.PauseTiming();
+      IL = new BN::LowLevelILFunction(&ARCH);
+      LIFTED = 0;
+      STATE.ResumeTiming();
+    }
+    LIFTED++;
+    size_t len = available;
+    ARCH.GetInstructionLowLevelIL(data, addr, len, *IL);
+    return len;
+  }
+
+ private:
+  HCS08::HCS08Architecture& ARCH;
+  benchmark::State& STATE;
+  BN::Ref<BN::LowLevelILFunction> IL;
+  size_t LIFTED = 0;
+};
+
+// Info, Text and Lift for the same address back to back, as Binary Ninja
+// calls them while analyzing a function
+class AnalysisCall {
+ public:
+  AnalysisCall(HCS08::HCS08Architecture& arch, benchmark::State& state)
+      : INFO(arch, state), TEXT(arch, state), LIFT(arch, state) {}
+
+  size_t Run(const uint8_t* data, uint64_t addr, size_t available) {
+    INFO.Run(data, addr, available);
+    TEXT.Run(data, addr, available);
+    return LIFT.Run(data, addr, available);
+  }
+
+ private:
+  InfoCall INFO;
+  TextCall TEXT;
+  LiftCall LIFT;
+};
+
+// One opcode from Opcodes::GetAllOpcodes() per benchmark
+template <typename Call>
+void BM_Opcode(benchmark::State& state) {
+  const auto bytes = Encode(static_cast<int>(state.range(0)));
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08bench");
+  Call call(*arch, state);
+  for (auto _ : state) {
+    call.Run(bytes.data(), BASE_ADDRESS, bytes.size());
+  }
+  state.SetLabel(HCS08::MnemonicToStr(Describe(state.range(0)).mnemonic));
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Every opcode of one addressing mode per iteration
+template <typename Call>
+void BM_Mode(benchmark::State& state) {
+  const auto mode = static_cast<HCS08::AddressingMode>(state.range(0));
+  std::vector<std::array<uint8_t, 4>> instructions;
+  for (const int opcode : OpcodesForMode(mode)) {
+    instructions.push_back(Encode(opcode));
+  }
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08bench");
+  Call call(*arch, state);
+  for (auto _ : state) {
+    for (const auto& bytes : instructions) {
+      call.Run(bytes.data(), BASE_ADDRESS, bytes.size());
+    }
+  }
+  state.SetLabel(MODE_NAMES[state.range(0)]);
+  state.SetItemsProcessed(state.iterations() * instructions.size());
+}
+
+// Linear sweep over a generated stream, as during initial analysis
+template <typename Call>
+void BM_Stream(benchmark::State& state) {
+  const std::vector<uint8_t>& stream = Stream(state.range(0));
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08bench");
+  Call call(*arch, state);
+  size_t count = 0;
+  for (auto _ : state) {
+    for (size_t offset = 0; offset < stream.size(); count++) {
+      offset += call.Run(stream.data() + offset, BASE_ADDRESS + offset,
+                         stream.size() - offset);
+    }
+  }
+  state.SetItemsProcessed(count);
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+// Table-driven sweep without the Binary Ninja callbacks, as a baseline for
+// the per-instruction overhead of the Architecture interface
+void BM_DecodeRangeStream(benchmark::State& state) {
+  const std::vector<uint8_t>& stream = Stream(state.range(0));
+  HCS08::DecodeSink sink;
+  sink.Reserve(stream.size());
+  size_t count = 0;
+  for (auto _ : state) {
+    sink.Clear();
+    count += HCS08::DecodeRange(stream.data(), stream.size(), BASE_ADDRESS,
+                                sink);
+  }
+  state.SetItemsProcessed(count);
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+// Disassembly text without Binary Ninja tokens, as hcs08-objdump renders it
+void BM_RenderStream(benchmark::State& state) {
+  const std::vector<uint8_t>& stream = Stream(state.range(0));
+  HCS08::RenderedInstruction rendered;
+  size_t count = 0;
+  for (auto _ : state) {
+    for (size_t offset = 0; offset < stream.size(); count++) {
+      size_t needed;
+      const HCS08::InstructionDescriptor* descriptor = HCS08::DecodeDescriptor(
+          stream.data() + offset, stream.size() - offset, needed);
+      HCS08::RenderInstruction(*descriptor, stream.data() + offset, rendered);
+      benchmark::DoNotOptimize(rendered.tokens.data());
+      offset += descriptor->length;
+    }
+  }
+  state.SetItemsProcessed(count);
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+// Simulator throughput on an endless checksum loop over the first 256 bytes
+// of the firmware stream; items are instructions, so items_per_second is IPS
+void BM_Simulator(benchmark::State& state) {
+  const std::vector<uint8_t> code = {
+      HCS08::Opcodes::LDHX_IMM, 0xC0, 0x00,     // restart: ldhx #$C000
+      HCS08::Opcodes::MOV_IMM_DIR, 0x00, 0x80,  // mov #0,$80 (256 passes)
+      HCS08::Opcodes::EOR_IX,                   // loop: eor ,x
+      HCS08::Opcodes::LSLA_INH,                 // lsla
+      HCS08::Opcodes::ADC_IMM, 0x00,            // adc #0
+      HCS08::Opcodes::AIX_IMM, 0x01,            // aix #1
+      HCS08::Opcodes::DBNZ_DIR, 0x80, 0xF7,     // dbnz $80,loop
+      HCS08::Opcodes::BRA_REL, 0xEF,            // bra restart
+  };
+  const auto simulator = std::make_unique<HCS08::Simulator>();
+  simulator->Load({{BASE_ADDRESS, code}, {0xC000, Stream(1)}});
+  simulator->State().pc = BASE_ADDRESS;
+  for (auto _ : state) {
+    simulator->Run(SIMULATE_BATCH);
+  }
+  benchmark::DoNotOptimize(simulator->State().a);
+  state.SetItemsProcessed(state.iterations() * SIMULATE_BATCH);
+}
+
+// Fuzzing-style resets: write a 16-byte input, run a short routine that sums
+// it and stores into RAM and the stack, then return to the snapshot taken
+// before; items are resets, so items_per_second is resets per second
+void BM_SimulatorReset(benchmark::State& state) {
+  const std::vector<uint8_t> code = {
+      HCS08::Opcodes::LDHX_IMM, 0x01, 0x00,     // ldhx #$0100
+      HCS08::Opcodes::CLRA_INH,                 // clra
+      HCS08::Opcodes::MOV_IMM_DIR, 0x10, 0x80,  // mov #16,$80
+      HCS08::Opcodes::ADD_IX,                   // loop: add ,x
+      HCS08::Opcodes::STA_IX,                   // sta ,x
+      HCS08::Opcodes::AIX_IMM, 0x01,            // aix #1
+      HCS08::Opcodes::DBNZ_DIR, 0x80, 0xF9,     // dbnz $80,loop
+      HCS08::Opcodes::RTS_INH,                  // rts
+  };
+  const auto simulator = std::make_unique<HCS08::Simulator>();
+  simulator->Load({{BASE_ADDRESS, code}});
+  const auto snapshot = std::make_unique<HCS08::Simulator::Snapshot>();
+  simulator->TakeSnapshot(*snapshot);
+  std::array<uint8_t, 16> input{};
+  for (auto _ : state) {
+    input[0]++;
+    simulator->Write(0x0100, input.data(), input.size());
+    simulator->Call(BASE_ADDRESS, 1000);
+    benchmark::DoNotOptimize(simulator->State().a);
+    simulator->Restore(*snapshot);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Trace decoding throughput on the steps of the checksum loop above, one
+// register snapshot every 256 steps; items are steps
+void BM_TraceCount(benchmark::State& state) {
+  const std::vector<uint8_t> code = {
+      HCS08::Opcodes::LDHX_IMM, 0xC0, 0x00,     // restart: ldhx #$C000
+      HCS08::Opcodes::MOV_IMM_DIR, 0x00, 0x80,  // mov #0,$80
+      HCS08::Opcodes::EOR_IX,                   // loop: eor ,x
+      HCS08::Opcodes::LSLA_INH,                 // lsla
+      HCS08::Opcodes::ADC_IMM, 0x00,            // adc #0
+      HCS08::Opcodes::AIX_IMM, 0x01,            // aix #1
+      HCS08::Opcodes::JSR_EXT, 0x90, 0x00,      // jsr $9000
+      HCS08::Opcodes::DBNZ_DIR, 0x80, 0xF4,     // dbnz $80,loop
+      HCS08::Opcodes::BRA_REL, 0xEC,            // bra restart
+  };
+  const auto simulator = std::make_unique<HCS08::Simulator>();
+  simulator->Load({{BASE_ADDRESS, code},
+                   {0x9000, {HCS08::Opcodes::RTS_INH}},
+                   {0xC000, Stream(1)}});
+  simulator->State().pc = BASE_ADDRESS;
+  std::ostringstream out;
+  HCS08::TraceWriter writer(out, true);
+  for (uint64_t i = 0; i < TRACE_STEPS; i++) {
+    const HCS08::CpuState& cpu = simulator->State();
+    if (i % 256 == 0) {
+      writer.Step(cpu.pc, {cpu.a, cpu.hx, cpu.sp, cpu.ccr});
+    } else {
+      writer.Step(cpu.pc);
+    }
+    simulator->Step();
+  }
+  writer.Finish();
+  const std::string trace = out.str();
+
+  for (auto _ : state) {
+    HCS08::TraceCoverage coverage;
+    HCS08::CountTraceHits(reinterpret_cast<const uint8_t*>(trace.data()),
+                          trace.size(), coverage);
+    benchmark::DoNotOptimize(coverage.steps);
+  }
+  state.SetItemsProcessed(state.iterations() * TRACE_STEPS);
+  state.SetBytesProcessed(state.iterations() * trace.size());
+}
+}  // namespace
+
+BENCHMARK(BM_Opcode<InfoCall>)->Name("Info/opcode")->Apply(AllOpcodes);
+BENCHMARK(BM_Opcode<TextCall>)->Name("Text/opcode")->Apply(AllOpcodes);
+BENCHMARK(BM_Opcode<LiftCall>)->Name("Lift/opcode")->Apply(AllOpcodes);
+
+BENCHMARK(BM_Mode<InfoCall>)->Name("Info/mode")->Apply(AllModes);
+BENCHMARK(BM_Mode<TextCall>)->Name("Text/mode")->Apply(AllModes);
+BENCHMARK(BM_Mode<LiftCall>)->Name("Lift/mode")->Apply(AllModes);
+
+BENCHMARK(BM_Stream<InfoCall>)->Name("Info/stream")->Apply(AllStreams);
+BENCHMARK(BM_Stream<TextCall>)->Name("Text/stream")->Apply(AllStreams);
+BENCHMARK(BM_Stream<LiftCall>)->Name("Lift/stream")->Apply(AllStreams);
+BENCHMARK(BM_Stream<AnalysisCall>)->Name("Analysis/stream")->Apply(AllStreams);
+BENCHMARK(BM_DecodeRangeStream)->Name("DecodeRange/stream")->Apply(AllStreams);
+
+BENCHMARK(BM_RenderStream)->Name("Render/stream")->Apply(AllStreams);
+
+BENCHMARK(BM_Simulator)->Name("Simulator/checksum");
+BENCHMARK(BM_SimulatorReset)->Name("Simulator/reset");
+BENCHMARK(BM_TraceCount)->Name("Trace/count");
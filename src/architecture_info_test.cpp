@@ -5,9 +5,13 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "architecture.h"
+#include "descriptors.h"
+#include "instrument.h"
+#include "instructions.h"
 #include "opcodes.h"
 
 namespace BN = BinaryNinja;
@@ -18,10 +22,15 @@ class TestInfoAllInstructions : public ::testing::TestWithParam<int> {};
 TEST_P(TestInfoAllInstructions, TestInfo) {
   const uint16_t opcode = GetParam();
 
-  const std::array<uint8_t, 2> bytes = {
-      static_cast<uint8_t>((opcode & 0xFF00) >> 8),
-      static_cast<uint8_t>(opcode & 0x00FF),
-  };
+  // Single-byte opcodes start the buffer; operand bytes are zero padded up to
+  // the longest instruction
+  std::array<uint8_t, 4> bytes = {};
+  if ((opcode & 0xFF00) >> 8 != HCS08::OpcodeFields::EXT_OP) {
+    bytes[0] = static_cast<uint8_t>(opcode & 0xFF);
+  } else {
+    bytes[0] = static_cast<uint8_t>((opcode & 0xFF00) >> 8);
+    bytes[1] = static_cast<uint8_t>(opcode & 0x00FF);
+  }
 
   const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08test");
   auto result = BN::InstructionInfo{};
@@ -30,9 +39,14 @@ TEST_P(TestInfoAllInstructions, TestInfo) {
       arch->GetInstructionInfo(bytes.data(), 0x0, bytes.size(), result));
 
   // decode the instruction again to ensure result.length is being set
-  const auto map = HCS08::GenerateInstructionMap();
-  const auto i = DecodeInstruction(bytes.data(), map);
-  EXPECT_EQ(result.length, i->get()->GetLength());
+  const auto descriptor = HCS08::LookupDescriptor(bytes.data());
+  ASSERT_NE(descriptor, nullptr);
+  EXPECT_EQ(result.length, descriptor->length);
+
+  // Lift finds the instruction from the descriptor instead of the bytes
+  EXPECT_NE(HCS08::LookupInstruction(*descriptor), nullptr);
+  EXPECT_EQ(HCS08::LookupInstruction(*descriptor),
+            HCS08::DecodeInstruction(bytes.data()));
 }
 
 // Test that all instructions are decoded
@@ -249,4 +263,96 @@ INSTANTIATE_TEST_SUITE_P(
 
       return "OP_" + op + "_" + fmt::format("{:x}", std::get<0>(info.param)) +
              "_REL_" + rel;
-    });
\ No newline at end of file
+    });
+
+// Test that rel operands of 4-byte and call instructions are sign-extended
+TEST(TestInfo, TestBackwardBranches) {
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08test");
+  const uint64_t addr = 0x1000;  // fake instruction address
+
+  const std::array<uint8_t, 4> dbnz = {
+      HCS08::OpcodeFields::EXT_OP,
+      HCS08::Opcodes::DBNZ_SP1 & 0xFF,
+      0x01,  // oprx8
+      0xF0,  // rel
+  };
+  auto result = BN::InstructionInfo{};
+  EXPECT_TRUE(arch->GetInstructionInfo(dbnz.data(), addr, dbnz.size(), result));
+  EXPECT_EQ(result.length, 4);
+  EXPECT_EQ(result.branchTarget[0], addr + 4 - 0x10);
+
+  const std::array<uint8_t, 2> bsr = {HCS08::Opcodes::BSR_REL, 0xFE};
+  result = BN::InstructionInfo{};
+  EXPECT_TRUE(arch->GetInstructionInfo(bsr.data(), addr, bsr.size(), result));
+  EXPECT_EQ(result.branchType[0], CallDestination);
+  EXPECT_EQ(result.branchTarget[0], addr);
+}
+
+// Test that instructions cut off by the end of the buffer are rejected and
+// report how many more bytes are required
+TEST(TestInfo, TestTruncated) {
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08test");
+  const std::array<uint8_t, 4> sp2 = {
+      HCS08::OpcodeFields::EXT_OP,
+      HCS08::Opcodes::ADC_SP2 & 0xFF,
+      0x12,
+      0x34,
+  };
+
+  for (size_t available = 0; available < sp2.size(); available++) {
+    auto result = BN::InstructionInfo{};
+    EXPECT_FALSE(
+        arch->GetInstructionInfo(sp2.data(), 0x1000, available, result));
+
+    size_t needed;
+    EXPECT_EQ(HCS08::DecodeDescriptor(sp2.data(), available, needed), nullptr);
+    // until the opcode is complete only the next opcode byte is requested
+    EXPECT_EQ(needed, available < 2 ? 1 : sp2.size() - available);
+  }
+
+  auto result = BN::InstructionInfo{};
+  EXPECT_TRUE(
+      arch->GetInstructionInfo(sp2.data(), 0x1000, sp2.size(), result));
+  EXPECT_EQ(result.length, 4);
+
+  size_t len = 2;
+  auto tokens = std::vector<BN::InstructionTextToken>{};
+  EXPECT_FALSE(arch->GetInstructionText(sp2.data(), 0x1000, len, tokens));
+  EXPECT_TRUE(tokens.empty());
+}
+
+// Test that instrumented builds count calls per opcode and failures by reason
+TEST(TestInfo, TestInstrument) {
+  if (!HCS08::Instrument::ENABLED) {
+    GTEST_SKIP() << "built without HCS08_INSTRUMENT";
+  }
+  using HCS08::Instrument::Callback;
+  using HCS08::Instrument::Failure;
+  HCS08::Instrument::Reset();
+
+  HCS08::HCS08Architecture arch("hcs08instrument");
+  const std::array<uint8_t, 3> lda = {HCS08::Opcodes::LDA_IMM, 0x42};
+  const std::array<uint8_t, 2> jsr = {HCS08::Opcodes::JSR_EXT, 0x12};
+  const std::array<uint8_t, 1> undefined = {0x8D};
+  BN::InstructionInfo info;
+  std::vector<BN::InstructionTextToken> tokens;
+  size_t len = lda.size();
+  arch.GetInstructionInfo(lda.data(), 0x1000, lda.size(), info);
+  arch.GetInstructionInfo(lda.data(), 0x1000, lda.size(), info);
+  arch.GetInstructionText(lda.data(), 0x1000, len, tokens);
+  arch.GetInstructionInfo(jsr.data(), 0x2000, jsr.size(), info);
+  arch.GetInstructionInfo(undefined.data(), 0x3000, undefined.size(), info);
+  // A thread's counters are kept after it exits
+  std::thread([&] {
+    BN::InstructionInfo threadInfo;
+    arch.GetInstructionInfo(lda.data(), 0x1000, lda.size(), threadInfo);
+  }).join();
+
+  HCS08::Instrument::Counters total;
+  HCS08::Instrument::Snapshot(total);
+  const auto& calls = total.calls;
+  EXPECT_EQ(calls[static_cast<size_t>(Callback::INFO)][0xA6], 3);
+  EXPECT_EQ(calls[static_cast<size_t>(Callback::TEXT)][0xA6], 1);
+  EXPECT_EQ(total.failures[static_cast<size_t>(Failure::TRUNCATED)], 1);
+  EXPECT_EQ(total.failures[static_cast<size_t>(Failure::UNDEFINED_OPCODE)], 1);
+}
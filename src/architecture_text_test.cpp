@@ -50,11 +50,11 @@ static void compare_text_tokens(
 
 // Verify that an architecture returns the correct text tokens
 static void test_architecture_text(
-    const uint8_t *opcode, const uint64_t address,
+    const uint8_t *opcode, const size_t length, const uint64_t address,
     const std::vector<BN::InstructionTextToken> &want) {
   const auto arch = std::make_unique<HCS08::HCS08Architecture>("hsc08test");
 
-  size_t len = 0;
+  size_t len = length;
   auto got = std::vector<BN::InstructionTextToken>{};
 
   EXPECT_TRUE(arch->GetInstructionText(opcode, address, len, got));
@@ -70,7 +70,7 @@ TEST_P(TestTextInh, TestText) {
       {InstructionToken, HCS08::Opcodes::NAMES.at(opcode)},
   };
 
-  test_architecture_text(&opcode, 0x0, want);
+  test_architecture_text(&opcode, 1, 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -125,7 +125,7 @@ TEST_P(TestTextImm8, TestText) {
       opcode,
       imm,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -171,7 +171,7 @@ TEST_P(TestTextImm16, TestText) {
       imm_high,
       imm_low,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -211,7 +211,7 @@ TEST_P(TestTextDir, TestText) {
       opcode,
       dir,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -265,7 +265,7 @@ TEST_P(TestTextExt, TestText) {
       opr16a_high,
       opr16a_low,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -319,7 +319,7 @@ TEST_P(TestTextIx2, TestText) {
       opr16a_high,
       opr16a_low,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -366,7 +366,7 @@ TEST_P(TestTextIx1, TestText) {
       opcode,
       oprx8,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -413,7 +413,7 @@ TEST_P(TestTextIx, TestText) {
   const std::array<uint8_t, 2> full_op = {
       opcode,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -459,7 +459,7 @@ TEST_P(TestTextSp1_3byte, TestText) {
       static_cast<uint8_t>(opcode & 0xFF),
       oprx8,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -516,7 +516,7 @@ TEST_P(TestTextSp1_4byte, TestText) {
       oprx8,
       rel,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -561,7 +561,7 @@ TEST_P(TestTextSp2, TestText) {
       opr16a_high,
       opr16a_low,
   };
-  test_architecture_text(full_op.data(), 0x0, want);
+  test_architecture_text(full_op.data(), full_op.size(), 0x0, want);
 }
 
 INSTANTIATE_TEST_SUITE_P(
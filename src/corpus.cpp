@@ -0,0 +1,387 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "corpus.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "descriptors.h"
+#include "opcodes.h"
+#include "sizes.h"
+
+namespace HCS08 {
+namespace {
+// Farthest back, in instructions, a generated loop branch may jump
+constexpr size_t LOOP_REACH = 16;
+
+/*
+ * The standard distributions are implementation-defined, so sampling is done
+ * directly on mt19937 output to produce the same image with every standard
+ * library.
+ */
+class Random {
+ public:
+  explicit Random(const uint32_t seed) : ENGINE(seed) {}
+
+  uint8_t Byte() { return ENGINE() >> 24; }
+
+  // Uniform integer in [0, bound)
+  size_t Below(const size_t bound) {
+    return static_cast<size_t>(static_cast<uint64_t>(ENGINE()) * bound >> 32);
+  }
+
+  // Uniform double in [0, 1)
+  double Unit() { return ENGINE() / 4294967296.0; }
+
+  bool Chance(const double probability) { return Unit() < probability; }
+
+ private:
+  std::mt19937 ENGINE;
+};
+
+/*
+ * Opcodes of one class with their cumulative weights, so a draw is a binary
+ * search on a uniform value scaled by the class total
+ */
+struct Bucket {
+  std::vector<uint16_t> opcodes;
+  std::vector<double> cumulative;
+
+  double Total() const { return cumulative.empty() ? 0 : cumulative.back(); }
+
+  void Add(const uint16_t opcode, const double weight) {
+    opcodes.push_back(opcode);
+    cumulative.push_back(Total() + weight);
+  }
+
+  uint16_t Pick(Random& random) const {
+    const auto it = std::upper_bound(cumulative.begin(), cumulative.end(),
+                                     random.Unit() * Total());
+    return opcodes[std::min<size_t>(it - cumulative.begin(),
+                                    opcodes.size() - 1)];
+  }
+};
+
+bool IsPrefixed(const uint16_t opcode) {
+  return opcode >> 8 == OpcodeFields::EXT_OP;
+}
+
+// Write the opcode bytes of an Opcodes:: value, returning their count
+size_t EncodeOpcode(const uint16_t opcode, uint8_t* bytes) {
+  if (IsPrefixed(opcode)) {
+    bytes[0] = OpcodeFields::EXT_OP;
+    bytes[1] = opcode & 0xFF;
+    return 2;
+  }
+  bytes[0] = opcode & 0xFF;
+  return 1;
+}
+
+const InstructionDescriptor& Describe(const uint16_t opcode) {
+  std::array<uint8_t, 2> bytes{};
+  EncodeOpcode(opcode, bytes.data());
+  return *LookupDescriptor(bytes.data());
+}
+
+bool HasRelOperand(const AddressingMode mode) {
+  switch (mode) {
+    case AddressingMode::REL:
+    case AddressingMode::BIT_DIR_REL:
+    case AddressingMode::IMM_REL:
+    case AddressingMode::DIR_REL:
+    case AddressingMode::INH_REL:
+    case AddressingMode::IX_REL:
+    case AddressingMode::IX1_REL:
+    case AddressingMode::IX_POSTINC_REL:
+    case AddressingMode::IX1_POSTINC_REL:
+    case AddressingMode::SP1_REL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/*
+ * Relative frequency of each mnemonic in compiled HCS08 code, which is
+ * dominated by accumulator loads and stores, compare and branch sequences,
+ * DBNZ/CBEQ loops and subroutine calls; everything else keeps a weight of one
+ * so every opcode still appears.
+ */
+double MnemonicWeight(const Mnemonic mnemonic) {
+  using enum Mnemonic;
+  switch (mnemonic) {
+    case LDA:
+    case STA:
+      return 40;
+    case LDHX:
+    case LDX:
+    case STX:
+    case STHX:
+      return 15;
+    case BEQ:
+    case BNE:
+    case BRA:
+    case JSR:
+    case BSR:
+    case RTS:
+      return 12;
+    case CMP:
+    case CPHX:
+    case BRSET:
+    case BRCLR:
+    case BSET:
+    case BCLR:
+    case DBNZ:
+    case DBNZA:
+    case DBNZX:
+    case CBEQ:
+    case CBEQA:
+    case INC:
+    case DEC:
+    case CLR:
+    case AIX:
+    case AIS:
+    case PSHA:
+    case PULA:
+      return 6;
+    default:
+      return 1;
+  }
+}
+
+std::string Lowercase(std::string text) {
+  std::transform(text.begin(), text.end(), text.begin(),
+                 [](const unsigned char c) { return std::tolower(c); });
+  return text;
+}
+
+bool ParseNumber(const std::string& token, double& value) {
+  const char* end = token.data() + token.size();
+  const auto [ptr, error] = std::from_chars(token.data(), end, value);
+  return error == std::errc() && ptr == end && value >= 0;
+}
+
+// Accepts "9ED6" and "0x9ED6"; only values present in Opcodes::NAMES
+bool ParseOpcode(const std::string& token, uint16_t& opcode) {
+  const char* begin = token.data();
+  const char* end = token.data() + token.size();
+  if (token.size() > 2 && token[0] == '0' && (token[1] | 0x20) == 'x') {
+    begin += 2;
+  }
+  const auto [ptr, error] = std::from_chars(begin, end, opcode, 16);
+  return error == std::errc() && ptr == end && Opcodes::NAMES.contains(opcode);
+}
+
+/*
+ * Point the rel operand of the instruction at starts[index] at another
+ * instruction boundary: with probability loopDensity a recent instruction at
+ * or before it (the back edge of a loop), otherwise one further ahead
+ */
+void PatchRelative(std::vector<uint8_t>& image,
+                   const std::vector<size_t>& starts, const size_t index,
+                   const size_t length, const double loopDensity,
+                   Random& random) {
+  const size_t next = starts[index] + length;
+  // Targets reachable with an 8-bit displacement from the next instruction
+  const size_t first = std::lower_bound(starts.begin(), starts.end(),
+                                        next < 128 ? 0 : next - 128) -
+                       starts.begin();
+  const size_t last =
+      std::upper_bound(starts.begin(), starts.end(), next + 127) -
+      starts.begin() - 1;
+
+  size_t lo = index + 1;
+  size_t hi = last;
+  if (random.Chance(loopDensity) || lo > hi) {
+    lo = std::max(first, index < LOOP_REACH ? 0 : index - LOOP_REACH);
+    hi = index;
+  }
+  const size_t target = starts[lo + random.Below(hi - lo + 1)];
+  image[next - 1] = static_cast<uint8_t>(static_cast<int>(target - next));
+}
+
+}  // namespace
+
+/**
+ * UniformProfile - Every opcode in Opcodes::NAMES with equal weight
+ * @return profile with no density overrides and no loops
+ */
+CorpusProfile UniformProfile() {
+  CorpusProfile profile;
+  for (const auto& [opcode, _] : Opcodes::NAMES) {
+    profile.weights[opcode] = 1;
+  }
+  return profile;
+}
+
+/**
+ * FirmwareProfile - Opcode mix approximating compiled HCS08 firmware
+ * @return profile weighting opcodes by mnemonic, with a quarter of the rel
+ * branches closing loops
+ */
+CorpusProfile FirmwareProfile() {
+  CorpusProfile profile;
+  for (const auto& [opcode, _] : Opcodes::NAMES) {
+    profile.weights[opcode] = MnemonicWeight(Describe(opcode).mnemonic);
+  }
+  profile.loopDensity = 0.25;
+  return profile;
+}
+
+/**
+ * ParseProfile - Read a frequency profile, one "<key> <value>" pair per line.
+ * A key is a mnemonic as listed in Opcodes::NAMES (weighting all of its
+ * opcodes), a hexadecimal opcode such as 9ED6, or one of branch-density,
+ * sp-density and loop-density. Text after '#' is ignored.
+ * @param input   - profile text
+ * @param profile - updated with the weights and densities read
+ * @return false on an unknown key, a malformed or negative value, or a
+ * density above 1
+ */
+bool ParseProfile(std::istream& input, CorpusProfile& profile) {
+  std::string line;
+  while (std::getline(input, line)) {
+    std::istringstream fields(line.substr(0, line.find('#')));
+    std::string key;
+    std::string valueText;
+    std::string extra;
+    if (!(fields >> key)) {
+      continue;
+    }
+    double value;
+    if (!(fields >> valueText) || fields >> extra ||
+        !ParseNumber(valueText, value)) {
+      return false;
+    }
+
+    key = Lowercase(key);
+    uint16_t opcode;
+    const bool density = key.ends_with("-density");
+    if (density && value > 1) {
+      return false;
+    } else if (key == "branch-density") {
+      profile.branchDensity = value;
+    } else if (key == "sp-density") {
+      profile.spDensity = value;
+    } else if (key == "loop-density") {
+      profile.loopDensity = value;
+    } else if (ParseOpcode(key, opcode)) {
+      profile.weights[opcode] = value;
+    } else {
+      bool found = false;
+      for (const auto& [candidate, name] : Opcodes::NAMES) {
+        if (name == key) {
+          profile.weights[candidate] = value;
+          found = true;
+        }
+      }
+      if (!found) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * GenerateCorpus - Build a deterministic image of back-to-back instructions.
+ * Opcodes are drawn from the profile, operands are random, and every rel and
+ * EXT branch is then pointed at an instruction boundary inside the image so
+ * recursive descent sees the same instructions as a linear sweep. A trailing
+ * gap too short for the next instruction is filled with NOPs.
+ * @param options - profile, seed, size and load address
+ * @return image bytes, exactly options.size long
+ */
+std::vector<uint8_t> GenerateCorpus(const CorpusOptions& options) {
+  const CorpusProfile& profile = options.profile;
+
+  // Split the opcodes by [branching][prefixed] so the densities can rescale
+  // each class without disturbing the weights inside it
+  std::array<std::array<Bucket, 2>, 2> buckets;
+  for (const auto& [opcode, weight] : profile.weights) {
+    if (weight > 0 && Opcodes::NAMES.contains(opcode)) {
+      buckets[Opcodes::BRANCHING.contains(opcode)][IsPrefixed(opcode)].Add(
+          opcode, weight);
+    }
+  }
+  std::array<double, 2> classTotals{};
+  for (size_t branching = 0; branching < 2; branching++) {
+    classTotals[branching] =
+        buckets[branching][0].Total() + buckets[branching][1].Total();
+  }
+
+  Bucket classes;  // draws a bucket index, branching * 2 + prefixed
+  for (size_t branching = 0; branching < 2; branching++) {
+    for (size_t prefixed = 0; prefixed < 2; prefixed++) {
+      const Bucket& bucket = buckets[branching][prefixed];
+      if (bucket.Total() == 0) {
+        continue;
+      }
+      double share = bucket.Total();
+      if (profile.spDensity >= 0 && buckets[branching][!prefixed].Total()) {
+        share = classTotals[branching] *
+                (prefixed ? profile.spDensity : 1 - profile.spDensity);
+      }
+      if (profile.branchDensity >= 0) {
+        share *= (branching ? profile.branchDensity
+                            : 1 - profile.branchDensity) /
+                 classTotals[branching];
+      }
+      classes.Add(branching * 2 + prefixed, std::max(share, 0.0));
+    }
+  }
+
+  Random random(options.seed);
+  std::vector<uint8_t> image;
+  image.reserve(options.size + Sizes::INSTRUCTION_4_BYTES);
+  std::vector<size_t> starts;
+  while (classes.Total() > 0) {
+    const uint16_t index = classes.Pick(random);
+    const uint16_t opcode = buckets[index >> 1][index & 1].Pick(random);
+    const InstructionDescriptor& descriptor = Describe(opcode);
+    if (image.size() + descriptor.length > options.size) {
+      break;
+    }
+    starts.push_back(image.size());
+    std::array<uint8_t, Sizes::INSTRUCTION_4_BYTES> bytes{};
+    const size_t opcodeLength = EncodeOpcode(opcode, bytes.data());
+    for (size_t i = opcodeLength; i < descriptor.length; i++) {
+      bytes[i] = random.Byte();
+    }
+    image.insert(image.end(), bytes.begin(), bytes.begin() + descriptor.length);
+  }
+  while (image.size() < options.size) {
+    starts.push_back(image.size());
+    image.push_back(Opcodes::NOP_INH);
+  }
+
+  for (size_t i = 0; i < starts.size(); i++) {
+    const InstructionDescriptor& descriptor =
+        *LookupDescriptor(&image[starts[i]]);
+    if (descriptor.branch == BranchKind::NONE ||
+        descriptor.branch == BranchKind::RETURN) {
+      continue;
+    }
+    if (HasRelOperand(descriptor.mode)) {
+      PatchRelative(image, starts, i, descriptor.length, profile.loopDensity,
+                    random);
+    } else if (descriptor.mode == AddressingMode::EXT) {
+      const uint16_t target =
+          options.base + starts[random.Below(starts.size())];
+      image[starts[i] + 1] = target >> 8;
+      image[starts[i] + 2] = target & 0xFF;
+    }
+  }
+  return image;
+}
+}  // namespace HCS08
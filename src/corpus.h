@@ -0,0 +1,42 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_CORPUS_H
+#define HCS08_CORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace HCS08 {
+/*
+ * Opcode frequency profile of a synthetic firmware image. Weights are relative
+ * and keyed by Opcodes:: value; opcodes without a weight are never emitted.
+ * A density overrides the share its weights would give a class of opcodes
+ * while keeping the relative weights inside the class; a negative density
+ * leaves the weights as given.
+ */
+struct CorpusProfile {
+  std::map<uint16_t, double> weights;
+  double branchDensity = -1;  // share of opcodes from Opcodes::BRANCHING
+  double spDensity = -1;      // share of 0x9E-prefixed (mostly SP-relative)
+  double loopDensity = 0;     // share of rel branches that jump backwards
+};
+
+struct CorpusOptions {
+  CorpusProfile profile;
+  uint32_t seed = 0x08;
+  size_t size = 4096;  // image size in bytes
+  uint16_t base = 0x8000;
+};
+
+CorpusProfile UniformProfile();
+CorpusProfile FirmwareProfile();
+bool ParseProfile(std::istream& input, CorpusProfile& profile);
+std::vector<uint8_t> GenerateCorpus(const CorpusOptions& options);
+}  // namespace HCS08
+
+#endif  // HCS08_CORPUS_H
@@ -0,0 +1,141 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "corpus.h"
+#include "srecord.h"
+
+namespace {
+constexpr const char* USAGE =
+    "usage: hcs08_corpus [options] OUTPUT\n"
+    "  --seed N            generator seed (default 8)\n"
+    "  --size N            image size in bytes (default 4096)\n"
+    "  --base ADDR         load address (default 0x8000)\n"
+    "  --format bin|srec   flat binary or S-records (default bin)\n"
+    "  --profile NAME      firmware, uniform or a profile file "
+    "(default firmware)\n"
+    "  --branch-density F  share of branching opcodes\n"
+    "  --sp-density F      share of 0x9E-prefixed opcodes\n"
+    "  --loop-density F    share of rel branches closing a loop\n";
+
+template <typename T>
+bool ParseValue(const std::string& text, T& value) {
+  const char* begin = text.data();
+  const char* end = text.data() + text.size();
+  if constexpr (std::is_integral_v<T>) {
+    int base = 10;
+    if (text.size() > 2 && text[0] == '0' && (text[1] | 0x20) == 'x') {
+      begin += 2;
+      base = 16;
+    }
+    const auto [ptr, error] = std::from_chars(begin, end, value, base);
+    return error == std::errc() && ptr == end;
+  } else {
+    const auto [ptr, error] = std::from_chars(begin, end, value);
+    return error == std::errc() && ptr == end && value >= 0 && value <= 1;
+  }
+}
+
+bool LoadProfile(const std::string& name, HCS08::CorpusProfile& profile) {
+  if (name == "firmware") {
+    profile = HCS08::FirmwareProfile();
+    return true;
+  }
+  if (name == "uniform") {
+    profile = HCS08::UniformProfile();
+    return true;
+  }
+  std::ifstream input(name);
+  profile = HCS08::CorpusProfile();
+  return input && HCS08::ParseProfile(input, profile);
+}
+
+int Fail(const std::string& message) {
+  std::cerr << "hcs08_corpus: " << message << "\n" << USAGE;
+  return 1;
+}
+}  // namespace
+
+/*
+ * Writes a synthetic HCS08 firmware image for benchmarking. The same options
+ * always produce the same bytes, so a corpus can be regenerated instead of
+ * checked in.
+ */
+int main(const int argc, char** argv) {
+  HCS08::CorpusOptions options;
+  options.profile = HCS08::FirmwareProfile();
+  std::string format = "bin";
+  std::string output;
+  // Density flags apply after --profile regardless of their order
+  double branchDensity = -1;
+  double spDensity = -1;
+  double loopDensity = -1;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg.starts_with("--") && i + 1 >= argc) {
+      return Fail("missing value for " + arg);
+    }
+    bool valid = true;
+    if (arg == "--seed") {
+      valid = ParseValue(argv[++i], options.seed);
+    } else if (arg == "--size") {
+      valid = ParseValue(argv[++i], options.size);
+    } else if (arg == "--base") {
+      valid = ParseValue(argv[++i], options.base);
+    } else if (arg == "--format") {
+      format = argv[++i];
+      valid = format == "bin" || format == "srec";
+    } else if (arg == "--profile") {
+      valid = LoadProfile(argv[++i], options.profile);
+    } else if (arg == "--branch-density") {
+      valid = ParseValue(argv[++i], branchDensity);
+    } else if (arg == "--sp-density") {
+      valid = ParseValue(argv[++i], spDensity);
+    } else if (arg == "--loop-density") {
+      valid = ParseValue(argv[++i], loopDensity);
+    } else if (arg.starts_with("--") || !output.empty()) {
+      return Fail("unexpected argument " + arg);
+    } else {
+      output = arg;
+    }
+    if (!valid) {
+      return Fail("invalid value for " + arg + ": " + argv[i]);
+    }
+  }
+  if (output.empty()) {
+    return Fail("no output file");
+  }
+  if (options.size > size_t{0x10000} - options.base) {
+    return Fail("image does not fit in the 64 KiB address space");
+  }
+  if (branchDensity >= 0) {
+    options.profile.branchDensity = branchDensity;
+  }
+  if (spDensity >= 0) {
+    options.profile.spDensity = spDensity;
+  }
+  if (loopDensity >= 0) {
+    options.profile.loopDensity = loopDensity;
+  }
+
+  const std::vector<uint8_t> image = HCS08::GenerateCorpus(options);
+  std::ofstream out(output, std::ios::binary);
+  if (format == "srec") {
+    out << HCS08::ToSRecords(image, options.base);
+  } else {
+    out.write(reinterpret_cast<const char*>(image.data()),
+              static_cast<std::streamsize>(image.size()));
+  }
+  if (!out) {
+    return Fail("cannot write " + output);
+  }
+  return 0;
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "corpus.h"
+#include "descriptors.h"
+#include "opcodes.h"
+#include "sweep.h"
+
+// Test that a generated corpus is reproducible, decodes without gaps and only
+// branches to instruction boundaries inside the image
+TEST(TestCorpus, TestGenerate) {
+  const HCS08::CorpusOptions options = {HCS08::FirmwareProfile(), 0x08, 4096,
+                                        0x8000};
+  const std::vector<uint8_t> image = HCS08::GenerateCorpus(options);
+  ASSERT_EQ(image.size(), options.size);
+  EXPECT_EQ(HCS08::GenerateCorpus(options), image);
+
+  HCS08::DecodeSink sink;
+  ASSERT_EQ(HCS08::DecodeRange(image.data(), image.size(), options.base, sink),
+            image.size());
+  const std::set<uint64_t> starts(sink.addresses.begin(),
+                                  sink.addresses.end());
+  for (size_t i = 0; i < sink.Size(); i++) {
+    EXPECT_NE(sink.mnemonics[i], HCS08::Mnemonic::INVALID);
+    if (sink.targets[i] != HCS08::DecodeSink::NO_TARGET &&
+        sink.opcodes[i] != HCS08::Opcodes::JSR_DIR &&
+        sink.opcodes[i] != HCS08::Opcodes::JMP_DIR) {
+      EXPECT_EQ(starts.count(sink.targets[i]), 1) << sink.addresses[i];
+    }
+  }
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "coverage.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "trace.h"
+
+namespace HCS08 {
+IntervalIndex::IntervalIndex(std::vector<Interval> intervals)
+    : INTERVALS(std::move(intervals)) {
+  std::sort(INTERVALS.begin(), INTERVALS.end(),
+            [](const Interval& a, const Interval& b) {
+              return a.start < b.start;
+            });
+  REACH.reserve(INTERVALS.size());
+  uint64_t reach = 0;
+  for (const Interval& interval : INTERVALS) {
+    reach = std::max(reach, interval.end);
+    REACH.push_back(reach);
+  }
+}
+
+/**
+ * SumIntervalHits - Add up the steps of a trace that fall in each interval.
+ * Only addresses the trace reached are looked up, so the cost depends on the
+ * size of the firmware, not the length of the trace.
+ * @param index    - intervals to count
+ * @param count    - one more than the largest Interval::id
+ * @param coverage - per-address counts from CountTraceHits
+ * @param result   - set to the sums, and the steps outside every interval
+ */
+void SumIntervalHits(const IntervalIndex& index, const size_t count,
+                     const TraceCoverage& coverage, IntervalHits& result) {
+  result.hits.assign(count, 0);
+  result.unmapped = 0;
+  result.unmappedAddresses = 0;
+  for (size_t addr = 0; addr < coverage.hits.size(); addr++) {
+    const uint64_t hits = coverage.hits[addr];
+    if (hits == 0) {
+      continue;
+    }
+    bool mapped = false;
+    index.ForEachContaining(addr, [&](const size_t id) {
+      result.hits[id] += hits;
+      mapped = true;
+    });
+    if (!mapped) {
+      result.unmapped += hits;
+      result.unmappedAddresses++;
+    }
+  }
+}
+}  // namespace HCS08
@@ -0,0 +1,70 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_COVERAGE_H
+#define HCS08_COVERAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "trace.h"
+
+namespace HCS08 {
+// Address range [start, end), e.g. one basic block
+struct Interval {
+  uint64_t start = 0;
+  uint64_t end = 0;
+  size_t id = 0;  // caller's index for the range
+};
+
+/*
+ * Finds the intervals that contain an address. Intervals may overlap, as the
+ * basic blocks of functions that share code do. They are kept sorted by start
+ * along with the largest end seen so far, so a lookup is a binary search plus
+ * a short walk back over the intervals that can still reach the address.
+ */
+class IntervalIndex {
+ public:
+  explicit IntervalIndex(std::vector<Interval> intervals);
+
+  template <typename Visitor>
+  void ForEachContaining(uint64_t addr, Visitor&& visit) const;
+
+ private:
+  std::vector<Interval> INTERVALS;  // by start
+  std::vector<uint64_t> REACH;      // largest end of INTERVALS[0..i]
+};
+
+template <typename Visitor>
+void IntervalIndex::ForEachContaining(const uint64_t addr,
+                                      Visitor&& visit) const {
+  size_t low = 0;
+  size_t high = INTERVALS.size();
+  while (low < high) {  // first interval starting after addr
+    const size_t mid = (low + high) / 2;
+    if (INTERVALS[mid].start <= addr) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  for (size_t i = low; i-- > 0 && REACH[i] > addr;) {
+    if (INTERVALS[i].end > addr) {
+      visit(INTERVALS[i].id);
+    }
+  }
+}
+
+// Trace hits summed per interval
+struct IntervalHits {
+  std::vector<uint64_t> hits;     // by Interval::id
+  uint64_t unmapped = 0;          // steps at addresses in no interval
+  uint64_t unmappedAddresses = 0;
+};
+
+void SumIntervalHits(const IntervalIndex& index, size_t count,
+                     const TraceCoverage& coverage, IntervalHits& result);
+}  // namespace HCS08
+
+#endif  // HCS08_COVERAGE_H
@@ -0,0 +1,96 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "decoder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "descriptors.h"
+
+namespace HCS08 {
+namespace {
+void AddBranch(DecodedInstruction& decoded, const BranchType type,
+               const uint16_t target = 0) {
+  decoded.branches[decoded.branchCount++] = {type, target};
+}
+}  // namespace
+
+/**
+ * DecodeFromDescriptor fills in a decoded instruction once its descriptor is
+ * known, including the control flow edges
+ * @param descriptor - descriptor of the instruction at data
+ * @param data       - instruction bytes, descriptor.length of them readable
+ * @param addr       - address of the instruction
+ * @param decoded    - populated with the decoded instruction
+ */
+void DecodeFromDescriptor(const InstructionDescriptor& descriptor,
+                          const uint8_t* data, const uint64_t addr,
+                          DecodedInstruction& decoded) {
+  decoded.addr = addr;
+  decoded.descriptor = &descriptor;
+  decoded.length = descriptor.length;
+  decoded.opcodeLength = GetOpcodeLength(descriptor);
+  decoded.operandCount = decoded.length - decoded.opcodeLength;
+  std::memcpy(decoded.bytes.data(), data, decoded.length);
+  std::memcpy(decoded.operands.data(), data + decoded.opcodeLength,
+              decoded.operandCount);
+
+  decoded.branchCount = 0;
+  uint16_t target = 0;
+  const bool direct = GetBranchTarget(descriptor, data, addr, target);
+  switch (descriptor.branch) {
+    case BranchKind::NONE:
+      break;
+
+    case BranchKind::JUMP:
+      if (direct) {
+        AddBranch(decoded, BranchType::UNCONDITIONAL, target);
+      } else {  // JMP through H:X
+        AddBranch(decoded, BranchType::INDIRECT);
+      }
+      break;
+
+    case BranchKind::CONDITIONAL:
+      // Note: BRSET/BRCLR, CBEQ and DBNZ depend on memory and may not be able
+      // to be resolved during analysis
+      AddBranch(decoded, BranchType::TRUE_BRANCH, target);
+      AddBranch(decoded, BranchType::FALSE_BRANCH,
+                static_cast<uint16_t>(addr + descriptor.length));
+      break;
+
+    case BranchKind::CALL:
+      // Calls through H:X have no statically known destination
+      if (direct) {
+        AddBranch(decoded, BranchType::CALL, target);
+      }
+      break;
+
+    case BranchKind::RETURN:
+      AddBranch(decoded, BranchType::RETURN);
+      break;
+  }
+}
+
+/**
+ * DecodeAt decodes the instruction at the start of a buffer
+ * @param data      - instruction bytes
+ * @param available - number of readable bytes at data
+ * @param addr      - address of data[0]
+ * @param decoded   - populated with the decoded instruction
+ * @param needed    - set to how many more bytes are required when data ends
+ * mid-instruction, 0 otherwise
+ * @return false if the opcode is undefined or the instruction is truncated
+ */
+bool DecodeAt(const uint8_t* data, const size_t available, const uint64_t addr,
+              DecodedInstruction& decoded, size_t& needed) {
+  const InstructionDescriptor* descriptor =
+      DecodeDescriptor(data, available, needed);
+  if (descriptor == nullptr) {
+    return false;
+  }
+  DecodeFromDescriptor(*descriptor, data, addr, decoded);
+  return true;
+}
+}  // namespace HCS08
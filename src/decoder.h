@@ -0,0 +1,61 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_DECODER_H
+#define HCS08_DECODER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "descriptors.h"
+#include "sizes.h"
+
+namespace HCS08 {
+/*
+ * Control flow edge of a decoded instruction. The plugin maps each type onto
+ * a BNBranchType; targets of RETURN and INDIRECT edges are always 0.
+ */
+enum class BranchType : uint8_t {
+  UNCONDITIONAL,
+  INDIRECT,  // JMP through H:X
+  TRUE_BRANCH,
+  FALSE_BRANCH,
+  CALL,
+  RETURN,
+};
+
+struct BranchInfo {
+  BranchType type;
+  uint16_t target;
+};
+
+/*
+ * Everything known about one instruction without Binary Ninja: its bytes
+ * split into opcode and operands, and its control flow edges.
+ */
+struct DecodedInstruction {
+  uint64_t addr = 0;
+  std::array<uint8_t, Sizes::INSTRUCTION_4_BYTES> bytes{};  // raw bytes
+  const InstructionDescriptor* descriptor = nullptr;  // opcode metadata
+  size_t length = 0;                                  // total length
+  size_t opcodeLength = 0;  // 1, or 2 for 0x9E-prefixed opcodes
+
+  // Operand bytes following the opcode (operands[0] is the first byte after
+  // the opcode); only the first operandCount entries are meaningful
+  std::array<uint8_t, Sizes::INSTRUCTION_3_BYTES> operands{};
+  size_t operandCount = 0;
+
+  // A conditional branch has a taken and a fall-through edge
+  std::array<BranchInfo, 2> branches{};
+  size_t branchCount = 0;
+};
+
+void DecodeFromDescriptor(const InstructionDescriptor& descriptor,
+                          const uint8_t* data, uint64_t addr,
+                          DecodedInstruction& decoded);
+bool DecodeAt(const uint8_t* data, size_t available, uint64_t addr,
+              DecodedInstruction& decoded, size_t& needed);
+}  // namespace HCS08
+
+#endif  // HCS08_DECODER_H
@@ -0,0 +1,112 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "decoder.h"
+#include "descriptors.h"
+#include "opcodes.h"
+
+// The core links without Binary Ninja; these exercise it on its own
+
+// Test that a conditional branch has a taken and a fall-through edge
+TEST(TestDecoder, TestConditional) {
+  const std::array<uint8_t, 2> bytes = {HCS08::Opcodes::BEQ_REL, 0xFE};
+  HCS08::DecodedInstruction decoded;
+  size_t needed;
+
+  ASSERT_TRUE(HCS08::DecodeAt(bytes.data(), bytes.size(), 0x8000, decoded,
+                              needed));
+  EXPECT_EQ(decoded.length, 2);
+  EXPECT_EQ(decoded.opcodeLength, 1);
+  EXPECT_EQ(decoded.operandCount, 1);
+  EXPECT_EQ(decoded.operands[0], 0xFE);
+  ASSERT_EQ(decoded.branchCount, 2);
+  EXPECT_EQ(decoded.branches[0].type, HCS08::BranchType::TRUE_BRANCH);
+  EXPECT_EQ(decoded.branches[0].target, 0x8000);
+  EXPECT_EQ(decoded.branches[1].type, HCS08::BranchType::FALSE_BRANCH);
+  EXPECT_EQ(decoded.branches[1].target, 0x8002);
+}
+
+// Test that direct and indirect calls and jumps get the expected edges
+TEST(TestDecoder, TestCallsAndJumps) {
+  const std::array<uint8_t, 3> call = {HCS08::Opcodes::JSR_EXT, 0xC0, 0x00};
+  const std::array<uint8_t, 1> indirectCall = {HCS08::Opcodes::JSR_IX};
+  const std::array<uint8_t, 1> indirectJump = {HCS08::Opcodes::JMP_IX};
+  const std::array<uint8_t, 1> ret = {HCS08::Opcodes::RTS_INH};
+  HCS08::DecodedInstruction decoded;
+  size_t needed;
+
+  ASSERT_TRUE(
+      HCS08::DecodeAt(call.data(), call.size(), 0x8000, decoded, needed));
+  ASSERT_EQ(decoded.branchCount, 1);
+  EXPECT_EQ(decoded.branches[0].type, HCS08::BranchType::CALL);
+  EXPECT_EQ(decoded.branches[0].target, 0xC000);
+
+  ASSERT_TRUE(HCS08::DecodeAt(indirectCall.data(), indirectCall.size(),
+                              0x8000, decoded, needed));
+  EXPECT_EQ(decoded.branchCount, 0);
+
+  ASSERT_TRUE(HCS08::DecodeAt(indirectJump.data(), indirectJump.size(),
+                              0x8000, decoded, needed));
+  ASSERT_EQ(decoded.branchCount, 1);
+  EXPECT_EQ(decoded.branches[0].type, HCS08::BranchType::INDIRECT);
+
+  ASSERT_TRUE(
+      HCS08::DecodeAt(ret.data(), ret.size(), 0x8000, decoded, needed));
+  ASSERT_EQ(decoded.branchCount, 1);
+  EXPECT_EQ(decoded.branches[0].type, HCS08::BranchType::RETURN);
+}
+
+// Test that truncated and undefined instructions are rejected
+TEST(TestDecoder, TestRejected) {
+  const std::array<uint8_t, 2> truncated = {HCS08::Opcodes::JSR_EXT, 0xC0};
+  const std::array<uint8_t, 1> undefined = {0x8D};
+  HCS08::DecodedInstruction decoded;
+  size_t needed;
+
+  EXPECT_FALSE(HCS08::DecodeAt(truncated.data(), truncated.size(), 0x8000,
+                               decoded, needed));
+  EXPECT_EQ(needed, 1);
+
+  EXPECT_FALSE(HCS08::DecodeAt(undefined.data(), undefined.size(), 0x8000,
+                               decoded, needed));
+  EXPECT_EQ(needed, 0);
+}
+
+// Test that every opcode has a descriptor whose mnemonic matches NAMES
+TEST(TestDecoder, TestDescriptors) {
+  for (const auto& [opcode, name] : HCS08::Opcodes::NAMES) {
+    const std::array<uint8_t, 2> bytes = {
+        static_cast<uint8_t>(opcode > 0xFF ? opcode >> 8 : opcode),
+        static_cast<uint8_t>(opcode & 0xFF),
+    };
+    const auto descriptor = HCS08::LookupDescriptor(bytes.data());
+    ASSERT_NE(descriptor, nullptr) << name;
+    EXPECT_EQ(descriptor->opcode, opcode);
+    EXPECT_EQ(HCS08::MnemonicToStr(descriptor->mnemonic), name);
+  }
+}
+
+// Test that only branches have a target, and only when it does not depend on
+// H:X
+TEST(TestDecoder, TestBranchTarget) {
+  const auto target = [](const std::array<uint8_t, 3>& bytes,
+                         uint16_t& result) {
+    const auto descriptor = HCS08::LookupDescriptor(bytes.data());
+    return descriptor != nullptr &&
+           HCS08::GetBranchTarget(*descriptor, bytes.data(), 0x8000, result);
+  };
+  uint16_t result = 0;
+  EXPECT_TRUE(target({HCS08::Opcodes::JMP_EXT, 0x12, 0x34}, result));
+  EXPECT_EQ(result, 0x1234);
+  EXPECT_TRUE(target({HCS08::Opcodes::BRA_REL, 0xFE}, result));
+  EXPECT_EQ(result, 0x8000);
+  EXPECT_FALSE(target({HCS08::Opcodes::LDA_EXT, 0x12, 0x34}, result));
+  EXPECT_FALSE(target({HCS08::Opcodes::LDA_DIR, 0x12}, result));
+  EXPECT_FALSE(target({HCS08::Opcodes::JSR_IX}, result));
+}
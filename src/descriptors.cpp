@@ -0,0 +1,764 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "descriptors.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "flags.h"
+#include "opcodes.h"
+#include "sizes.h"
+
+namespace HCS08 {
+namespace {
+constexpr const char* MNEMONICS[] = {
+    "adc", "add", "ais", "aix", "and", "asr", "asra", "asrx", "bcc", "bclr",
+    "bcs", "beq", "bge", "bgnd", "bgt", "bhcc", "bhcs", "bhi", "bih", "bil",
+    "bit", "ble", "bls", "blt", "bmc", "bmi", "bms", "bne", "bpl", "bra",
+    "brclr", "brn", "brset", "bset", "bsr", "cbeq", "cbeqa", "cbeqx", "clc",
+    "cli", "clr", "clra", "clrh", "clrx", "cmp", "com", "coma", "comx", "cphx",
+    "cpx", "daa", "dbnz", "dbnza", "dbnzx", "dec", "deca", "decx", "div",
+    "eor", "inc", "inca", "incx", "jmp", "jsr", "lda", "ldhx", "ldx", "lsl",
+    "lsla", "lslx", "lsr", "lsra", "lsrx", "mov", "mul", "neg", "nega", "negx",
+    "nop", "nsa", "ora", "psha", "pshh", "pshx", "pula", "pulh", "pulx", "rol",
+    "rola", "rolx", "ror", "rora", "rorx", "rsp", "rti", "rts", "sbc", "sec",
+    "sei", "sta", "sthx", "stop", "stx", "sub", "swi", "tap", "tax", "tpa",
+    "tst", "tsta", "tstx", "tsx", "txa", "txs", "wait", "invalid"};
+
+// One descriptor per documented opcode, in opcode order
+constexpr InstructionDescriptor DESCRIPTORS[] = {
+    {Opcodes::BRSET_DIR_B0, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B0, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B1, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B1, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B2, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B2, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B3, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B3, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B4, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B4, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B5, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B5, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B6, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B6, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRSET_DIR_B7, Mnemonic::BRSET, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BRCLR_DIR_B7, Mnemonic::BRCLR, AddressingMode::BIT_DIR_REL, 3,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BSET_DIR_B0, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B0, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B1, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B1, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B2, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B2, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B3, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B3, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B4, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B4, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B5, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B5, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B6, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B6, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BSET_DIR_B7, Mnemonic::BSET, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BCLR_DIR_B7, Mnemonic::BCLR, AddressingMode::BIT_DIR, 2,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BRA_REL, Mnemonic::BRA, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::BRN_REL, Mnemonic::BRN, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::BHI_REL, Mnemonic::BHI, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BLS_REL, Mnemonic::BLS, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BCC_BHS_REL, Mnemonic::BCC, AddressingMode::REL, 2,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BCS_BLO_REL, Mnemonic::BCS, AddressingMode::REL, 2,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BNE_REL, Mnemonic::BNE, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BEQ_REL, Mnemonic::BEQ, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BHCC_REL, Mnemonic::BHCC, AddressingMode::REL, 2,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BHCS_REL, Mnemonic::BHCS, AddressingMode::REL, 2,
+     Flags::FLAGS_NONE, BranchKind::CONDITIONAL},
+    {Opcodes::BPL_REL, Mnemonic::BPL, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BMI_REL, Mnemonic::BMI, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BMC_REL, Mnemonic::BMC, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BMS_REL, Mnemonic::BMS, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BIL_REL, Mnemonic::BIL, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BIH_REL, Mnemonic::BIH, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::NEG_DIR, Mnemonic::NEG, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQ_DIR, Mnemonic::CBEQ, AddressingMode::DIR_REL, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::LDHX_EXT, Mnemonic::LDHX, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::COM_DIR, Mnemonic::COM, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSR_DIR, Mnemonic::LSR, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::STHX_DIR, Mnemonic::STHX, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROR_DIR, Mnemonic::ROR, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASR_DIR, Mnemonic::ASR, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSL_DIR, Mnemonic::LSL, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROL_DIR, Mnemonic::ROL, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DEC_DIR, Mnemonic::DEC, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::DBNZ_DIR, Mnemonic::DBNZ, AddressingMode::DIR_REL, 3,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INC_DIR, Mnemonic::INC, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TST_DIR, Mnemonic::TST, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPHX_EXT, Mnemonic::CPHX, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CLR_DIR, Mnemonic::CLR, AddressingMode::DIR, 2, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::NEGA_INH, Mnemonic::NEGA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQA_IMM, Mnemonic::CBEQA, AddressingMode::IMM_REL, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::MUL_INH, Mnemonic::MUL, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::COMA_INH, Mnemonic::COMA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSRA_INH, Mnemonic::LSRA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDHX_IMM, Mnemonic::LDHX, AddressingMode::IMM16, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::RORA_INH, Mnemonic::RORA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASRA_INH, Mnemonic::ASRA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSLA_INH, Mnemonic::LSLA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROLA_INH, Mnemonic::ROLA, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DECA_INH, Mnemonic::DECA, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::DBNZA_INH, Mnemonic::DBNZA, AddressingMode::INH_REL, 2,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INCA_INH, Mnemonic::INCA, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TSTA_INH, Mnemonic::TSTA, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::MOV_DIR_DIR, Mnemonic::MOV, AddressingMode::DIR_DIR, 3,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::CLRA_INH, Mnemonic::CLRA, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::NEGX_INH, Mnemonic::NEGX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQX_IMM, Mnemonic::CBEQX, AddressingMode::IMM_REL, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::DIV_INH, Mnemonic::DIV, AddressingMode::INH, 1, Flags::FLAGS_C_Z,
+     BranchKind::NONE},
+    {Opcodes::COMX_INH, Mnemonic::COMX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSRX_INH, Mnemonic::LSRX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDHX_DIR, Mnemonic::LDHX, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::RORX_INH, Mnemonic::RORX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASRX_INH, Mnemonic::ASRX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSLX_INH, Mnemonic::LSLX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROLX_INH, Mnemonic::ROLX, AddressingMode::INH, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DECX_INH, Mnemonic::DECX, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::DBNZX_INH, Mnemonic::DBNZX, AddressingMode::INH_REL, 2,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INCX_INH, Mnemonic::INCX, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TSTX_INH, Mnemonic::TSTX, AddressingMode::INH, 1,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::MOV_DIR_IX_POSTINC, Mnemonic::MOV, AddressingMode::DIR_IX_POSTINC,
+     2, Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::CLRX_INH, Mnemonic::CLRX, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::NEG_IX1, Mnemonic::NEG, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQ_IX1_POSTINC, Mnemonic::CBEQ, AddressingMode::IX1_POSTINC_REL,
+     3, Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::NSA_INH, Mnemonic::NSA, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::COM_IX1, Mnemonic::COM, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSR_IX1, Mnemonic::LSR, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPHX_IMM, Mnemonic::CPHX, AddressingMode::IMM16, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROR_IX1, Mnemonic::ROR, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASR_IX1, Mnemonic::ASR, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSL_IX1, Mnemonic::LSL, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROL_IX1, Mnemonic::ROL, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DEC_IX1, Mnemonic::DEC, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::DBNZ_IX1, Mnemonic::DBNZ, AddressingMode::IX1_REL, 3,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INC_IX1, Mnemonic::INC, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TST_IX1, Mnemonic::TST, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::MOV_IMM_DIR, Mnemonic::MOV, AddressingMode::IMM_DIR, 3,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::CLR_IX1, Mnemonic::CLR, AddressingMode::IX1, 2, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::NEG_IX, Mnemonic::NEG, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQ_IX_POSTINC, Mnemonic::CBEQ, AddressingMode::IX_POSTINC_REL,
+     2, Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::DAA_INH, Mnemonic::DAA, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::COM_IX, Mnemonic::COM, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSR_IX, Mnemonic::LSR, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPHX_DIR, Mnemonic::CPHX, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROR_IX, Mnemonic::ROR, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASR_IX, Mnemonic::ASR, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSL_IX, Mnemonic::LSL, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROL_IX, Mnemonic::ROL, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DEC_IX, Mnemonic::DEC, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::DBNZ_IX, Mnemonic::DBNZ, AddressingMode::IX_REL, 2,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INC_IX, Mnemonic::INC, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::TST_IX, Mnemonic::TST, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::MOV_IX_POSTINC_DIR, Mnemonic::MOV, AddressingMode::IX_POSTINC_DIR,
+     2, Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::CLR_IX, Mnemonic::CLR, AddressingMode::IX, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::RTI_INH, Mnemonic::RTI, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::RETURN},
+    {Opcodes::RTS_INH, Mnemonic::RTS, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::RETURN},
+    {Opcodes::BGND_INH, Mnemonic::BGND, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::SWI_INH, Mnemonic::SWI, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::TAP_INH, Mnemonic::TAP, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::TPA_INH, Mnemonic::TPA, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::PULA_INH, Mnemonic::PULA, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::PSHA_INH, Mnemonic::PSHA, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::PULX_INH, Mnemonic::PULX, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::PSHX_INH, Mnemonic::PSHX, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::PULH_INH, Mnemonic::PULH, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::PSHH_INH, Mnemonic::PSHH, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::CLRH_INH, Mnemonic::CLRH, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::STOP_INH, Mnemonic::STOP, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::WAIT_INH, Mnemonic::WAIT, AddressingMode::INH, 1,
+     Flags::FLAGS_NONE, BranchKind::NONE},
+    {Opcodes::BGE_REL, Mnemonic::BGE, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BLT_REL, Mnemonic::BLT, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BGT_REL, Mnemonic::BGT, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::BLE_REL, Mnemonic::BLE, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CONDITIONAL},
+    {Opcodes::TXS_INH, Mnemonic::TXS, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::TSX_INH, Mnemonic::TSX, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::STHX_EXT, Mnemonic::STHX, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TAX_INH, Mnemonic::TAX, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::CLC_INH, Mnemonic::CLC, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::SEC_INH, Mnemonic::SEC, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::CLI_INH, Mnemonic::CLI, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::SEI_INH, Mnemonic::SEI, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::RSP_INH, Mnemonic::RSP, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::NOP_INH, Mnemonic::NOP, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::TXA_INH, Mnemonic::TXA, AddressingMode::INH, 1, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::SUB_IMM, Mnemonic::SUB, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_IMM, Mnemonic::CMP, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_IMM, Mnemonic::SBC, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_IMM, Mnemonic::CPX, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_IMM, Mnemonic::AND, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_IMM, Mnemonic::BIT, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_IMM, Mnemonic::LDA, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::AIS_IMM, Mnemonic::AIS, AddressingMode::IMM, 2, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::EOR_IMM, Mnemonic::EOR, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_IMM, Mnemonic::ADC, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_IMM, Mnemonic::ORA, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_IMM, Mnemonic::ADD, AddressingMode::IMM, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::BSR_REL, Mnemonic::BSR, AddressingMode::REL, 2, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_IMM, Mnemonic::LDX, AddressingMode::IMM, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::AIX_IMM, Mnemonic::AIX, AddressingMode::IMM, 2, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::SUB_DIR, Mnemonic::SUB, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_DIR, Mnemonic::CMP, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_DIR, Mnemonic::SBC, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_DIR, Mnemonic::CPX, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_DIR, Mnemonic::AND, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_DIR, Mnemonic::BIT, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_DIR, Mnemonic::LDA, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_DIR, Mnemonic::STA, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_DIR, Mnemonic::EOR, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_DIR, Mnemonic::ADC, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_DIR, Mnemonic::ORA, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_DIR, Mnemonic::ADD, AddressingMode::DIR, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::JMP_DIR, Mnemonic::JMP, AddressingMode::DIR, 2, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::JSR_DIR, Mnemonic::JSR, AddressingMode::DIR, 2, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_DIR, Mnemonic::LDX, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_DIR, Mnemonic::STX, AddressingMode::DIR, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_EXT, Mnemonic::SUB, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_EXT, Mnemonic::CMP, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_EXT, Mnemonic::SBC, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_EXT, Mnemonic::CPX, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_EXT, Mnemonic::AND, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_EXT, Mnemonic::BIT, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_EXT, Mnemonic::LDA, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_EXT, Mnemonic::STA, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_EXT, Mnemonic::EOR, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_EXT, Mnemonic::ADC, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_EXT, Mnemonic::ORA, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_EXT, Mnemonic::ADD, AddressingMode::EXT, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::JMP_EXT, Mnemonic::JMP, AddressingMode::EXT, 3, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::JSR_EXT, Mnemonic::JSR, AddressingMode::EXT, 3, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_EXT, Mnemonic::LDX, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_EXT, Mnemonic::STX, AddressingMode::EXT, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_IX2, Mnemonic::SUB, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_IX2, Mnemonic::CMP, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_IX2, Mnemonic::SBC, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_IX2, Mnemonic::CPX, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_IX2, Mnemonic::AND, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_IX2, Mnemonic::BIT, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_IX2, Mnemonic::LDA, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_IX2, Mnemonic::STA, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_IX2, Mnemonic::EOR, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_IX2, Mnemonic::ADC, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_IX2, Mnemonic::ORA, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_IX2, Mnemonic::ADD, AddressingMode::IX2, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::JMP_IX2, Mnemonic::JMP, AddressingMode::IX2, 3, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::JSR_IX2, Mnemonic::JSR, AddressingMode::IX2, 3, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_IX2, Mnemonic::LDX, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_IX2, Mnemonic::STX, AddressingMode::IX2, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_IX1, Mnemonic::SUB, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_IX1, Mnemonic::CMP, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_IX1, Mnemonic::SBC, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_IX1, Mnemonic::CPX, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_IX1, Mnemonic::AND, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_IX1, Mnemonic::BIT, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_IX1, Mnemonic::LDA, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_IX1, Mnemonic::STA, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_IX1, Mnemonic::EOR, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_IX1, Mnemonic::ADC, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_IX1, Mnemonic::ORA, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_IX1, Mnemonic::ADD, AddressingMode::IX1, 2,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::JMP_IX1, Mnemonic::JMP, AddressingMode::IX1, 2, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::JSR_IX1, Mnemonic::JSR, AddressingMode::IX1, 2, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_IX1, Mnemonic::LDX, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_IX1, Mnemonic::STX, AddressingMode::IX1, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_IX, Mnemonic::SUB, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_IX, Mnemonic::CMP, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_IX, Mnemonic::SBC, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_IX, Mnemonic::CPX, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_IX, Mnemonic::AND, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::BIT_IX, Mnemonic::BIT, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::LDA_IX, Mnemonic::LDA, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::STA_IX, Mnemonic::STA, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::EOR_IX, Mnemonic::EOR, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::ADC_IX, Mnemonic::ADC, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_IX, Mnemonic::ORA, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::ADD_IX, Mnemonic::ADD, AddressingMode::IX, 1,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::JMP_IX, Mnemonic::JMP, AddressingMode::IX, 1, Flags::FLAGS_NONE,
+     BranchKind::JUMP},
+    {Opcodes::JSR_IX, Mnemonic::JSR, AddressingMode::IX, 1, Flags::FLAGS_NONE,
+     BranchKind::CALL},
+    {Opcodes::LDX_IX, Mnemonic::LDX, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::STX_IX, Mnemonic::STX, AddressingMode::IX, 1, Flags::FLAGS_Z_N_V,
+     BranchKind::NONE},
+    {Opcodes::NEG_SP1, Mnemonic::NEG, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CBEQ_SP1, Mnemonic::CBEQ, AddressingMode::SP1_REL, 4,
+     Flags::FLAGS_C_Z_N_V, BranchKind::CONDITIONAL},
+    {Opcodes::COM_SP1, Mnemonic::COM, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSR_SP1, Mnemonic::LSR, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROR_SP1, Mnemonic::ROR, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ASR_SP1, Mnemonic::ASR, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LSL_SP1, Mnemonic::LSL, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::ROL_SP1, Mnemonic::ROL, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::DEC_SP1, Mnemonic::DEC, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::DBNZ_SP1, Mnemonic::DBNZ, AddressingMode::SP1_REL, 4,
+     Flags::FLAGS_Z, BranchKind::CONDITIONAL},
+    {Opcodes::INC_SP1, Mnemonic::INC, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::TST_SP1, Mnemonic::TST, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::CLR_SP1, Mnemonic::CLR, AddressingMode::SP1, 3, Flags::FLAGS_NONE,
+     BranchKind::NONE},
+    {Opcodes::LDHX_IX, Mnemonic::LDHX, AddressingMode::IX, 2,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDHX_IX2, Mnemonic::LDHX, AddressingMode::IX2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDHX_IX1, Mnemonic::LDHX, AddressingMode::IX1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_SP2, Mnemonic::SUB, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_SP2, Mnemonic::CMP, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_SP2, Mnemonic::SBC, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_SP2, Mnemonic::CPX, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_SP2, Mnemonic::AND, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_SP2, Mnemonic::BIT, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_SP2, Mnemonic::LDA, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_SP2, Mnemonic::STA, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_SP2, Mnemonic::EOR, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_SP2, Mnemonic::ADC, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_SP2, Mnemonic::ORA, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_SP2, Mnemonic::ADD, AddressingMode::SP2, 4,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::LDX_SP2, Mnemonic::LDX, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_SP2, Mnemonic::STX, AddressingMode::SP2, 4,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::SUB_SP1, Mnemonic::SUB, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CMP_SP1, Mnemonic::CMP, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::SBC_SP1, Mnemonic::SBC, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPX_SP1, Mnemonic::CPX, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::AND_SP1, Mnemonic::AND, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::BIT_SP1, Mnemonic::BIT, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDA_SP1, Mnemonic::LDA, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STA_SP1, Mnemonic::STA, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::EOR_SP1, Mnemonic::EOR, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADC_SP1, Mnemonic::ADC, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::ORA_SP1, Mnemonic::ORA, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::ADD_SP1, Mnemonic::ADD, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_H_V, BranchKind::NONE},
+    {Opcodes::LDX_SP1, Mnemonic::LDX, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STX_SP1, Mnemonic::STX, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::CPHX_SP1, Mnemonic::CPHX, AddressingMode::SP1, 3,
+     Flags::FLAGS_C_Z_N_V, BranchKind::NONE},
+    {Opcodes::LDHX_SP1, Mnemonic::LDHX, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+    {Opcodes::STHX_SP1, Mnemonic::STHX, AddressingMode::SP1, 3,
+     Flags::FLAGS_Z_N_V, BranchKind::NONE},
+};
+
+using DescriptorPage = std::array<InstructionDescriptor, 256>;
+
+/*
+ * Scatter DESCRIPTORS into a 256-entry page indexed by the last opcode byte.
+ * Unassigned slots keep length 0, which LookupDescriptor treats as invalid.
+ */
+constexpr DescriptorPage GeneratePage(const bool extended) {
+  DescriptorPage page{};
+  for (auto& descriptor : page) {
+    descriptor.mnemonic = Mnemonic::INVALID;
+    descriptor.flagWrite = Flags::FLAGS_NONE;
+  }
+  for (const auto& descriptor : DESCRIPTORS) {
+    if ((descriptor.opcode >> 8 == OpcodeFields::EXT_OP) == extended) {
+      page[descriptor.opcode & 0xFF] = descriptor;
+    }
+  }
+  return page;
+}
+
+constexpr DescriptorPage PRIMARY = GeneratePage(false);
+constexpr DescriptorPage EXTENDED = GeneratePage(true);
+}  // namespace
+
+/**
+ * LookupDescriptor resolves the opcode at the start of data
+ * @param data - instruction bytes; data[1] is read only for 0x9E-prefixed
+ * opcodes
+ * @return descriptor for the opcode, or nullptr if the opcode is undefined
+ */
+const InstructionDescriptor* LookupDescriptor(const uint8_t* data) {
+  const InstructionDescriptor* descriptor = data[0] == OpcodeFields::EXT_OP
+                                                ? &EXTENDED[data[1]]
+                                                : &PRIMARY[data[0]];
+  return descriptor->length == 0 ? nullptr : descriptor;
+}
+
+/**
+ * DecodeDescriptor is the bounds-checked decoder front end. Short buffers are
+ * rejected before the opcode table is consulted or any operand is read.
+ * @param data      - instruction bytes
+ * @param available - number of readable bytes at data
+ * @param needed    - set to how many more bytes are required when data ends
+ * mid-instruction, 0 otherwise
+ * @return descriptor for the opcode, or nullptr if the opcode is undefined or
+ * the instruction is truncated (needed > 0)
+ */
+const InstructionDescriptor* DecodeDescriptor(const uint8_t* data,
+                                              const size_t available,
+                                              size_t& needed) {
+  needed = 0;
+  if (available < Sizes::INSTRUCTION_1_BYTE) {
+    needed = Sizes::INSTRUCTION_1_BYTE - available;
+    return nullptr;
+  }
+  // The full length of a prefixed opcode is unknown until the second byte is
+  // read, so only ask for that byte
+  if (data[0] == OpcodeFields::EXT_OP &&
+      available < Sizes::INSTRUCTION_2_BYTES) {
+    needed = Sizes::INSTRUCTION_2_BYTES - available;
+    return nullptr;
+  }
+
+  const InstructionDescriptor* descriptor = LookupDescriptor(data);
+  if (descriptor == nullptr) {
+    return nullptr;
+  }
+  if (available < descriptor->length) {
+    needed = descriptor->length - available;
+    return nullptr;
+  }
+  return descriptor;
+}
+
+const char* MnemonicToStr(const Mnemonic mnemonic) {
+  return MNEMONICS[static_cast<size_t>(mnemonic)];
+}
+
+/**
+ * GetOpcodeLength returns the number of opcode bytes, 1 or 2 if the opcode is
+ * prefixed with 0x9E; operands start immediately after
+ */
+size_t GetOpcodeLength(const InstructionDescriptor& descriptor) {
+  return descriptor.opcode >> 8 == OpcodeFields::EXT_OP
+             ? Sizes::INSTRUCTION_2_BYTES
+             : Sizes::INSTRUCTION_1_BYTE;
+}
+
+/**
+ * GetBranchTarget computes the destination of a JUMP, CALL or CONDITIONAL
+ * instruction
+ * @param descriptor - descriptor of the instruction at addr
+ * @param data       - instruction bytes
+ * @param addr       - address of the instruction
+ * @param target     - set to the (taken) branch destination
+ * @return false if the instruction does not branch (descriptor.branch is
+ * NONE) or its destination depends on H:X (indexed JMP/JSR)
+ */
+bool GetBranchTarget(const InstructionDescriptor& descriptor,
+                     const uint8_t* data, const uint64_t addr,
+                     uint16_t& target) {
+  if (descriptor.branch == BranchKind::NONE) {
+    return false;
+  }
+  switch (descriptor.mode) {
+    case AddressingMode::DIR:  // Direct page address $00xx
+      target = data[1];
+      return true;
+    case AddressingMode::EXT:
+      target = data[1] << 8 | data[2];
+      return true;
+    case AddressingMode::REL:
+    case AddressingMode::BIT_DIR_REL:
+    case AddressingMode::IMM_REL:
+    case AddressingMode::DIR_REL:
+    case AddressingMode::INH_REL:
+    case AddressingMode::IX_REL:
+    case AddressingMode::IX1_REL:
+    case AddressingMode::IX_POSTINC_REL:
+    case AddressingMode::IX1_POSTINC_REL:
+    case AddressingMode::SP1_REL:
+      // The rel operand is always the last byte and is relative to the next
+      // instruction
+      target = addr + descriptor.length +
+               static_cast<int8_t>(data[descriptor.length - 1]);
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace HCS08
@@ -0,0 +1,98 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_DESCRIPTORS_H
+#define HCS08_DESCRIPTORS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace HCS08 {
+/*
+ * Instruction mnemonics, in alphabetical order. Aliases that share an opcode
+ * (BHS/BCC, BLO/BCS, LSL/ASL) use the name printed in disassembly.
+ */
+enum class Mnemonic : uint8_t {
+  ADC, ADD, AIS, AIX, AND, ASR, ASRA, ASRX, BCC, BCLR, BCS, BEQ, BGE, BGND,
+  BGT, BHCC, BHCS, BHI, BIH, BIL, BIT, BLE, BLS, BLT, BMC, BMI, BMS, BNE, BPL,
+  BRA, BRCLR, BRN, BRSET, BSET, BSR, CBEQ, CBEQA, CBEQX, CLC, CLI, CLR, CLRA,
+  CLRH, CLRX, CMP, COM, COMA, COMX, CPHX, CPX, DAA, DBNZ, DBNZA, DBNZX, DEC,
+  DECA, DECX, DIV, EOR, INC, INCA, INCX, JMP, JSR, LDA, LDHX, LDX, LSL, LSLA,
+  LSLX, LSR, LSRA, LSRX, MOV, MUL, NEG, NEGA, NEGX, NOP, NSA, ORA, PSHA, PSHH,
+  PSHX, PULA, PULH, PULX, ROL, ROLA, ROLX, ROR, RORA, RORX, RSP, RTI, RTS, SBC,
+  SEC, SEI, STA, STHX, STOP, STX, SUB, SWI, TAP, TAX, TPA, TST, TSTA, TSTX,
+  TSX, TXA, TXS, WAIT, INVALID
+};
+
+/*
+ * Operand layout of an instruction, named after the addressing mode notation
+ * used in the HCS08 reference manual. Compound modes list their operands in
+ * encoding order, e.g. BIT_DIR_REL is "n,opr8a,rel" (BRSET/BRCLR) and
+ * DIR_IX_POSTINC is "opr8a,X+" (MOV).
+ */
+enum class AddressingMode : uint8_t {
+  INH,              // no operand
+  IMM,              // #opr8i
+  IMM16,            // #opr16i
+  DIR,              // opr8a
+  EXT,              // opr16a
+  IX,               // ,X
+  IX1,              // oprx8,X
+  IX2,              // oprx16,X
+  SP1,              // oprx8,SP
+  SP2,              // oprx16,SP
+  REL,              // rel
+  BIT_DIR,          // n,opr8a
+  BIT_DIR_REL,      // n,opr8a,rel
+  IMM_REL,          // #opr8i,rel
+  DIR_REL,          // opr8a,rel
+  INH_REL,          // rel, operating on A or X
+  IX_REL,           // ,X,rel
+  IX1_REL,          // oprx8,X,rel
+  IX_POSTINC_REL,   // ,X+,rel
+  IX1_POSTINC_REL,  // oprx8,X+,rel
+  SP1_REL,          // oprx8,SP,rel
+  DIR_DIR,          // opr8a,opr8a
+  DIR_IX_POSTINC,   // opr8a,X+
+  IMM_DIR,          // #opr8i,opr8a
+  IX_POSTINC_DIR,   // ,X+,opr8a
+};
+
+/*
+ * Control flow behavior of an instruction. The target of a JUMP or CALL is
+ * taken from the rel operand (always the last instruction byte), the DIR/EXT
+ * address operand, or is unknown for indexed modes.
+ */
+enum class BranchKind : uint8_t {
+  NONE,
+  JUMP,         // BRA, JMP
+  CONDITIONAL,  // Bcc, BRSET/BRCLR, CBEQ, DBNZ
+  CALL,         // BSR, JSR
+  RETURN,       // RTS, RTI
+};
+
+/*
+ * Static description of one opcode. Descriptors are plain data stored in two
+ * contiguous 256-entry pages (primary and 0x9E-prefixed) so decoding an
+ * instruction is a single indexed load.
+ */
+struct InstructionDescriptor {
+  uint16_t opcode;  // Opcodes:: value, including the 0x9E prefix
+  Mnemonic mnemonic;
+  AddressingMode mode;
+  uint8_t length;     // total length in bytes, including the prefix
+  uint8_t flagWrite;  // Flags:: flag group, or Flags::FLAGS_NONE
+  BranchKind branch;
+};
+
+const InstructionDescriptor* LookupDescriptor(const uint8_t* data);
+const InstructionDescriptor* DecodeDescriptor(const uint8_t* data,
+                                              size_t available,
+                                              size_t& needed);
+const char* MnemonicToStr(Mnemonic mnemonic);
+size_t GetOpcodeLength(const InstructionDescriptor& descriptor);
+bool GetBranchTarget(const InstructionDescriptor& descriptor,
+                     const uint8_t* data, uint64_t addr, uint16_t& target);
+}  // namespace HCS08
+
+#endif  // HCS08_DESCRIPTORS_H
@@ -0,0 +1,336 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "difftest.h"
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "descriptors.h"
+#include "evaluator.h"
+#include "flags.h"
+#include "opcodes.h"
+#include "registers.h"
+#include "simulator.h"
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+namespace {
+constexpr uint8_t CCR_ONES = 0x60;  // CCR bits 5 and 6 always read as 1
+constexpr uint16_t COMPARED_FLAGS = 1 << Flags::FLAG_C | 1 << Flags::FLAG_Z |
+                                    1 << Flags::FLAG_N | 1 << Flags::FLAG_I |
+                                    1 << Flags::FLAG_H | 1 << Flags::FLAG_V;
+
+// Values at the edges of the flag logic, drawn more often than chance would
+constexpr std::array<uint8_t, 9> EDGE_BYTES = {0x00, 0x01, 0x09, 0x0F, 0x10,
+                                               0x7F, 0x80, 0x99, 0xFF};
+constexpr std::array<uint16_t, 8> EDGE_WORDS = {
+    0x0000, 0x0001, 0x00FF, 0x0100, 0x7FFF, 0x8000, 0xFFFE, 0xFFFF};
+
+// Per-thread state, reused for every opcode the thread checks
+struct Worker {
+  explicit Worker(BN::Architecture* arch) : evaluator(arch) {}
+
+  IlEvaluator evaluator;
+  std::unique_ptr<Simulator> simulator = std::make_unique<Simulator>();
+  std::unique_ptr<Simulator::Snapshot> snapshot =
+      std::make_unique<Simulator::Snapshot>();  // the simulator on image
+  std::vector<uint8_t> image = std::vector<uint8_t>(Simulator::MEMORY_SIZE);
+  IlProgram program;
+  IlMachine machine;
+  std::mt19937_64 random;
+};
+
+uint8_t RandomByte(std::mt19937_64& random) {
+  const uint64_t draw = random();
+  return (draw & 3) == 0 ? EDGE_BYTES[(draw >> 8) % EDGE_BYTES.size()]
+                         : static_cast<uint8_t>(draw >> 32);
+}
+
+uint16_t RandomWord(std::mt19937_64& random) {
+  const uint64_t draw = random();
+  return (draw & 3) == 0 ? EDGE_WORDS[(draw >> 8) % EDGE_WORDS.size()]
+                         : static_cast<uint16_t>(draw >> 32);
+}
+
+// Register state and memory the IL and the simulator start from
+void StartCase(Worker& worker, const uint16_t pc, CpuState& state) {
+  state = {};
+  state.a = RandomByte(worker.random);
+  state.hx = RandomWord(worker.random);
+  state.sp = RandomWord(worker.random);
+  state.pc = pc;
+  state.ccr = RandomByte(worker.random) | CCR_ONES;
+
+  IlMachine& machine = worker.machine;
+  machine.registers = {};
+  machine.registers[Registers::HCS08_REG_A] = state.a;
+  machine.registers[Registers::HCS08_REG_HX] = state.hx;
+  machine.registers[Registers::HCS08_REG_SP] = state.sp;
+  machine.registers[Registers::HCS08_REG_PC] = state.pc;
+  machine.registers[Registers::HCS08_REG_CCR] = state.ccr;
+  machine.flags = state.ccr;
+  machine.undefinedFlags = 0;
+  machine.memory = worker.image.data();
+  machine.writes.clear();
+}
+
+/*
+ * Fields the hardware leaves indeterminate: DIV sets C on overflow or a zero
+ * divisor, and the quotient, remainder and Z are then unspecified
+ */
+uint16_t IndeterminateFields(const Mnemonic mnemonic,
+                             const CpuState& reference) {
+  if (mnemonic == Mnemonic::DIV &&
+      (reference.ccr >> Flags::FLAG_C & 1) != 0) {
+    return DiffFields::A | DiffFields::HX |
+           1 << (DiffFields::FLAG_SHIFT + Flags::FLAG_Z);
+  }
+  return 0;
+}
+
+// Value of addr after the IL ran: its last store there, else the image
+uint8_t IlMemory(const IlMachine& machine, const uint16_t addr) {
+  for (auto it = machine.writes.rbegin(); it != machine.writes.rend(); ++it) {
+    if (it->first == addr) {
+      return it->second;
+    }
+  }
+  return machine.memory[addr];
+}
+
+void Record(OpcodeReport& report, bool& mismatched, const uint16_t field,
+            const uint16_t address, const uint32_t expected,
+            const uint32_t actual) {
+  report.fields |= field;
+  if (report.mismatched == 0 && !mismatched) {
+    report.first.field = field;
+    report.first.address = address;
+    report.first.expected = expected;
+    report.first.actual = actual;
+  }
+  mismatched = true;
+}
+
+/**
+ * Compare - Compare the simulator and IL states after one case
+ * @param worker  - holds both states
+ * @param before  - state both started from
+ * @param ignored - DiffFields bits not to compare
+ * @param report  - counts and first mismatch
+ * @return whether any compared field disagreed
+ */
+bool Compare(Worker& worker, const CpuState& before, const uint16_t ignored,
+             OpcodeReport& report) {
+  CpuState expected = worker.simulator->State();
+  const IlMachine& actual = worker.machine;
+  bool mismatched = false;
+
+  // The core accounts for the return address of an IL call, so the bytes the
+  // CPU stacked for it are not expected from the IL
+  const uint16_t returnHigh = before.sp - 1;
+  if (actual.called) {
+    expected.sp += 2;
+  }
+  const auto check = [&](const uint16_t field, const uint32_t want,
+                         const uint32_t got) {
+    if ((ignored & field) == 0 && want != got) {
+      Record(report, mismatched, field, 0, want, got);
+    }
+  };
+  check(DiffFields::A, expected.a,
+        actual.registers[Registers::HCS08_REG_A] & 0xFF);
+  check(DiffFields::HX, expected.hx,
+        actual.registers[Registers::HCS08_REG_HX] & 0xFFFF);
+  check(DiffFields::SP, expected.sp,
+        actual.registers[Registers::HCS08_REG_SP] & 0xFFFF);
+  check(DiffFields::PC, expected.pc, actual.pc);
+  for (uint8_t flag = 0; flag < 8; flag++) {
+    if ((COMPARED_FLAGS >> flag & 1) != 0 &&
+        (actual.undefinedFlags >> flag & 1) == 0) {
+      check(1 << (DiffFields::FLAG_SHIFT + flag), expected.ccr >> flag & 1,
+            actual.flags >> flag & 1);
+    }
+  }
+
+  // Every byte the IL stored must match, and every byte the simulator
+  // changed must have been stored by the IL
+  const uint8_t* memory = worker.simulator->Memory();
+  const uint8_t* image = worker.image.data();
+  const auto checkByte = [&](const uint16_t addr) {
+    const uint8_t got = IlMemory(actual, addr);
+    if (actual.called &&
+        (addr == returnHigh || addr == static_cast<uint16_t>(returnHigh + 1))) {
+      return;
+    }
+    if ((ignored & DiffFields::MEMORY) == 0 && memory[addr] != got) {
+      Record(report, mismatched, DiffFields::MEMORY, addr, memory[addr], got);
+    }
+  };
+  for (const auto& [addr, _] : actual.writes) {
+    checkByte(addr);
+  }
+  for (const uint8_t page : worker.simulator->DirtyPages()) {
+    const size_t start = page * Simulator::PAGE_SIZE;
+    for (size_t addr = start; addr < start + Simulator::PAGE_SIZE; addr++) {
+      if (memory[addr] != image[addr]) {
+        checkByte(addr);
+      }
+    }
+  }
+  return mismatched;
+}
+
+/**
+ * CheckOpcode - Lift random encodings of one opcode and compare each on
+ * random register and memory states against the simulator
+ * @param arch    - architecture that lifts
+ * @param options - case counts and seed
+ * @param worker  - per-thread scratch
+ * @param report  - opcode to check; receives the counts
+ */
+void CheckOpcode(BN::Architecture* arch, const DiffOptions& options,
+                 Worker& worker, OpcodeReport& report) {
+  // Seeded by opcode so results do not depend on the thread schedule
+  worker.random.seed(options.seed * 0x9E3779B97F4A7C15ULL + report.opcode);
+  std::array<uint8_t, 4> bytes{};
+  size_t prefix = 0;
+  if (report.opcode >> 8 == OpcodeFields::EXT_OP) {
+    bytes[prefix++] = OpcodeFields::EXT_OP;
+  }
+  bytes[prefix++] = report.opcode & 0xFF;
+
+  for (uint64_t done = 0; done < options.casesPerOpcode;) {
+    for (size_t i = prefix; i < bytes.size(); i++) {
+      bytes[i] = RandomByte(worker.random);
+    }
+    const InstructionDescriptor* descriptor = LookupDescriptor(bytes.data());
+    if (descriptor == nullptr) {
+      return;
+    }
+
+    // A fresh memory image with the instruction at a random address
+    for (size_t i = 0; i < worker.image.size(); i += 8) {
+      const uint64_t draw = worker.random();
+      std::memcpy(&worker.image[i], &draw, sizeof(draw));
+    }
+    const uint16_t pc = worker.random() % (Simulator::MEMORY_SIZE - 4);
+    std::copy(bytes.begin(), bytes.end(), worker.image.begin() + pc);
+    std::copy(worker.image.begin(), worker.image.end(),
+              worker.simulator->Memory());
+    worker.simulator->Invalidate();
+    worker.simulator->TakeSnapshot(*worker.snapshot);
+
+    BN::Ref<BN::LowLevelILFunction> il = new BN::LowLevelILFunction(arch);
+    size_t len = bytes.size();
+    const bool lifted =
+        arch->GetInstructionLowLevelIL(bytes.data(), pc, len, *il) &&
+        CompileIl(*il, pc + len, worker.program);
+
+    const uint64_t states =
+        std::min<uint64_t>(options.statesPerEncoding,
+                           options.casesPerOpcode - done);
+    for (uint64_t i = 0; i < states; i++, done++) {
+      CpuState& state = worker.simulator->State();
+      StartCase(worker, pc, state);
+      const CpuState before = state;
+      const IlOutcome outcome =
+          lifted ? worker.evaluator.Run(worker.program, worker.machine)
+                 : IlOutcome::UNSUPPORTED;
+      worker.simulator->Step();
+      if (outcome != IlOutcome::OK) {
+        report.skipped++;
+        report.skipReason = outcome;
+        worker.simulator->Restore(*worker.snapshot);
+        continue;
+      }
+      report.compared++;
+      const bool mismatched =
+          Compare(worker, before,
+                  IndeterminateFields(descriptor->mnemonic, state), report);
+      worker.simulator->Restore(*worker.snapshot);
+      if (mismatched) {
+        if (report.mismatched == 0) {
+          report.first.bytes = bytes;
+          report.first.before = before;
+        }
+        report.mismatched++;
+      }
+    }
+  }
+}
+}  // namespace
+
+/**
+ * RunDifferential - Check the lifter against the simulator, one opcode per
+ * job, spread over options.jobs threads
+ * @param arch    - architecture that lifts
+ * @param opcodes - opcodes to check, as in Opcodes::NAMES
+ * @param options - case counts, seed and thread count
+ * @return one report per opcode, in the order given
+ */
+std::vector<OpcodeReport> RunDifferential(BN::Architecture* arch,
+                                          const std::vector<uint16_t>& opcodes,
+                                          const DiffOptions& options) {
+  std::vector<OpcodeReport> reports(opcodes.size());
+  for (size_t i = 0; i < opcodes.size(); i++) {
+    reports[i].opcode = opcodes[i];
+  }
+  std::atomic<size_t> next = 0;
+  const auto work = [&] {
+    Worker worker(arch);
+    for (size_t i; (i = next.fetch_add(1)) < reports.size();) {
+      CheckOpcode(arch, options, worker, reports[i]);
+    }
+  };
+  std::vector<std::thread> threads;
+  const size_t count = std::clamp<size_t>(options.jobs, 1, opcodes.size());
+  for (size_t i = 1; i < count; i++) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return reports;
+}
+
+/**
+ * DescribeFields - Name the fields in a DiffFields mask
+ * @param fields - DiffFields bits
+ * @return names separated by spaces, e.g. "a hx flag.c"
+ */
+std::string DescribeFields(const uint16_t fields) {
+  static constexpr std::array<const char*, 5> NAMES = {"a", "hx", "sp", "pc",
+                                                       "memory"};
+  static constexpr std::array<const char*, 8> FLAG_NAMES = {
+      "c", "z", "n", "i", "h", "", "", "v"};
+  std::string text;
+  const auto append = [&](const std::string& name) {
+    text += text.empty() ? name : " " + name;
+  };
+  for (size_t i = 0; i < NAMES.size(); i++) {
+    if ((fields >> i & 1) != 0) {
+      append(NAMES[i]);
+    }
+  }
+  for (size_t flag = 0; flag < FLAG_NAMES.size(); flag++) {
+    if ((fields >> (DiffFields::FLAG_SHIFT + flag) & 1) != 0) {
+      append(std::string("flag.") + FLAG_NAMES[flag]);
+    }
+  }
+  return text;
+}
+}  // namespace HCS08
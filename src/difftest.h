@@ -0,0 +1,64 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_DIFFTEST_H
+#define HCS08_DIFFTEST_H
+
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "evaluator.h"
+#include "simulator.h"
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+// Parts of the machine state compared after each case, as bits of a mask
+namespace DiffFields {
+constexpr uint16_t A = 1 << 0;
+constexpr uint16_t HX = 1 << 1;
+constexpr uint16_t SP = 1 << 2;
+constexpr uint16_t PC = 1 << 3;
+constexpr uint16_t MEMORY = 1 << 4;
+constexpr uint16_t FLAG_SHIFT = 8;  // CCR bit n is bit FLAG_SHIFT + n
+}  // namespace DiffFields
+
+struct DiffOptions {
+  uint64_t casesPerOpcode = 1 << 16;
+  uint32_t statesPerEncoding = 64;  // register states run on each lift
+  uint64_t seed = 0x08;
+  size_t jobs = 1;
+};
+
+// First disagreement seen for an opcode, enough to reproduce it by hand
+struct DiffMismatch {
+  std::array<uint8_t, 4> bytes{};
+  CpuState before;
+  uint16_t field = 0;    // DiffFields bit that disagreed
+  uint16_t address = 0;  // memory address, for DiffFields::MEMORY
+  uint32_t expected = 0;  // reference interpreter
+  uint32_t actual = 0;    // lifted IL
+};
+
+struct OpcodeReport {
+  uint16_t opcode = 0;     // as in Opcodes::NAMES; page 2 is $9Exx
+  uint64_t compared = 0;   // cases where the IL ran to completion
+  uint64_t mismatched = 0;
+  uint64_t skipped = 0;    // cases the IL did not define
+  IlOutcome skipReason = IlOutcome::OK;
+  uint16_t fields = 0;     // every DiffFields bit that ever disagreed
+  DiffMismatch first;
+};
+
+std::vector<OpcodeReport> RunDifferential(BN::Architecture* arch,
+                                          const std::vector<uint16_t>& opcodes,
+                                          const DiffOptions& options);
+std::string DescribeFields(uint16_t fields);
+}  // namespace HCS08
+
+#endif  // HCS08_DIFFTEST_H
@@ -0,0 +1,155 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "architecture.h"
+#include "difftest.h"
+#include "opcodes.h"
+
+namespace BN = BinaryNinja;
+
+namespace {
+constexpr const char* USAGE =
+    "usage: hcs08-difftest [--jobs N] [--cases N] [--seed N] [OPCODE...]\n"
+    "  --jobs N   worker threads (default: one per core)\n"
+    "  --cases N  cases per opcode (default 65536)\n"
+    "  --seed N   random seed (default 8)\n"
+    "  OPCODE     opcode to check, e.g. 0x52 or 0x9EE6 (default: all)\n";
+
+int Fail(const std::string& message) {
+  std::cerr << "hcs08-difftest: " << message << "\n" << USAGE;
+  return 1;
+}
+
+template <typename T>
+bool ParseNumber(std::string_view value, T& result) {
+  int radix = 10;
+  if (value.starts_with("0x") || value.starts_with("0X")) {
+    value.remove_prefix(2);
+    radix = 16;
+  }
+  const char* end = value.data() + value.size();
+  const auto [ptr, error] = std::from_chars(value.data(), end, result, radix);
+  return error == std::errc() && ptr == end;
+}
+
+const char* OutcomeName(const HCS08::IlOutcome outcome) {
+  switch (outcome) {
+    case HCS08::IlOutcome::UNIMPLEMENTED:
+      return "unimplemented";
+    case HCS08::IlOutcome::UNDEFINED:
+      return "undefined";
+    case HCS08::IlOutcome::UNSUPPORTED:
+      return "unsupported";
+    default:
+      return "";
+  }
+}
+
+void PrintReport(const HCS08::OpcodeReport& report) {
+  std::printf("%04X\t%s\t%llu\t%llu\t%llu", report.opcode,
+              HCS08::Opcodes::NAMES.at(report.opcode).c_str(),
+              static_cast<unsigned long long>(report.compared),
+              static_cast<unsigned long long>(report.mismatched),
+              static_cast<unsigned long long>(report.skipped));
+  if (report.mismatched == 0) {
+    std::printf("\t%s\n", OutcomeName(report.skipReason));
+    return;
+  }
+  const HCS08::DiffMismatch& first = report.first;
+  std::printf(
+      "\t%s\tbytes=%02X %02X %02X %02X a=%02X hx=%04X sp=%04X pc=%04X "
+      "ccr=%02X",
+      HCS08::DescribeFields(report.fields).c_str(), first.bytes[0],
+      first.bytes[1], first.bytes[2], first.bytes[3], first.before.a,
+      first.before.hx, first.before.sp, first.before.pc, first.before.ccr);
+  if (first.field == HCS08::DiffFields::MEMORY) {
+    std::printf(" memory[%04X]", first.address);
+  } else {
+    std::printf(" %s", HCS08::DescribeFields(first.field).c_str());
+  }
+  std::printf(" expected=%X lifted=%X\n", first.expected, first.actual);
+}
+}  // namespace
+
+/*
+ * Lifts every opcode (or the ones named) with random operands, evaluates the
+ * IL on random register and memory states and compares the result with the
+ * simulator. Prints one tab-separated line per opcode with the first
+ * disagreement, and exits nonzero if any opcode disagreed.
+ */
+int main(const int argc, char** argv) {
+  HCS08::DiffOptions options;
+  options.jobs = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<uint16_t> opcodes;
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with("--") && i + 1 >= argc) {
+      return Fail("missing value for " + std::string(arg));
+    }
+    bool valid = true;
+    if (arg == "--jobs") {
+      valid = ParseNumber(argv[++i], options.jobs) && options.jobs > 0;
+    } else if (arg == "--cases") {
+      valid = ParseNumber(argv[++i], options.casesPerOpcode);
+    } else if (arg == "--seed") {
+      valid = ParseNumber(argv[++i], options.seed);
+    } else if (arg.starts_with("--")) {
+      return Fail("unexpected argument " + std::string(arg));
+    } else {
+      uint16_t opcode = 0;
+      if (!ParseNumber(arg, opcode) ||
+          !HCS08::Opcodes::NAMES.contains(opcode)) {
+        return Fail("unknown opcode " + std::string(arg));
+      }
+      opcodes.push_back(opcode);
+      continue;
+    }
+    if (!valid) {
+      return Fail("invalid value for " + std::string(arg) + ": " + argv[i]);
+    }
+  }
+  if (opcodes.empty()) {
+    for (const int opcode : HCS08::Opcodes::GetAllOpcodes()) {
+      opcodes.push_back(static_cast<uint16_t>(opcode));
+    }
+    std::sort(opcodes.begin(), opcodes.end());
+  }
+
+  HCS08::HCS08Architecture arch("hcs08difftest");
+  const auto start = std::chrono::steady_clock::now();
+  const std::vector<HCS08::OpcodeReport> reports =
+      HCS08::RunDifferential(&arch, opcodes, options);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("opcode\tname\tcompared\tmismatched\tskipped\tfields\n");
+  uint64_t cases = 0;
+  size_t failed = 0;
+  for (const HCS08::OpcodeReport& report : reports) {
+    PrintReport(report);
+    cases += report.compared + report.skipped;
+    failed += report.mismatched != 0;
+  }
+  std::fprintf(stderr,
+               "%zu of %zu opcodes disagree; %llu cases in %.3f s "
+               "(%.1f M/min) on %zu threads\n",
+               failed, reports.size(), static_cast<unsigned long long>(cases),
+               elapsed.count(), cases / elapsed.count() * 60 / 1e6,
+               std::min(options.jobs, reports.size()));
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "architecture.h"
+#include "difftest.h"
+#include "evaluator.h"
+#include "flags.h"
+#include "opcodes.h"
+#include "registers.h"
+
+namespace {
+// Lift bytes at addr into program
+bool Lift(HCS08::HCS08Architecture& arch, const std::vector<uint8_t>& bytes,
+          const uint16_t addr, HCS08::IlProgram& program) {
+  BN::Ref<BN::LowLevelILFunction> il = new BN::LowLevelILFunction(&arch);
+  size_t len = bytes.size();
+  return arch.GetInstructionLowLevelIL(bytes.data(), addr, len, *il) &&
+         HCS08::CompileIl(*il, addr + len, program);
+}
+}  // namespace
+
+// Test evaluating a lifted add, with its flags derived from their roles
+TEST(TestEvaluator, TestAdd) {
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08test");
+  const HCS08::IlEvaluator evaluator(arch.get());
+  HCS08::IlProgram program;
+  ASSERT_TRUE(Lift(*arch, {HCS08::Opcodes::ADD_IMM, 0x01}, 0x8000, program));
+
+  const std::array<uint8_t, 1> memory{};
+  HCS08::IlMachine machine;
+  machine.memory = memory.data();
+  machine.registers[HCS08::Registers::HCS08_REG_A] = 0x7F;
+  EXPECT_EQ(evaluator.Run(program, machine), HCS08::IlOutcome::OK);
+  EXPECT_EQ(machine.registers[HCS08::Registers::HCS08_REG_A], 0x80);
+  EXPECT_EQ(machine.pc, 0x8002);
+  EXPECT_EQ(machine.flags >> HCS08::Flags::FLAG_V & 1, 1);
+  EXPECT_EQ(machine.flags >> HCS08::Flags::FLAG_N & 1, 1);
+  EXPECT_EQ(machine.flags >> HCS08::Flags::FLAG_Z & 1, 0);
+  EXPECT_EQ(machine.flags >> HCS08::Flags::FLAG_C & 1, 0);
+}
+
+// Test that loads, stores, an add and DIV agree with the simulator everywhere
+TEST(TestDifferential, TestAgreement) {
+  const auto arch = std::make_unique<HCS08::HCS08Architecture>("hcs08test");
+  HCS08::DiffOptions options;
+  options.casesPerOpcode = 4096;
+  options.jobs = 2;
+  const std::vector<uint16_t> opcodes = {
+      HCS08::Opcodes::LDA_IMM, HCS08::Opcodes::LDA_DIR,
+      HCS08::Opcodes::STA_DIR, HCS08::Opcodes::ADD_IMM,
+      HCS08::Opcodes::DIV_INH};
+  const std::vector<HCS08::OpcodeReport> reports =
+      HCS08::RunDifferential(arch.get(), opcodes, options);
+
+  ASSERT_EQ(reports.size(), opcodes.size());
+  for (const HCS08::OpcodeReport& report : reports) {
+    EXPECT_EQ(report.mismatched, 0)
+        << HCS08::Opcodes::NAMES.at(report.opcode) << ": "
+        << HCS08::DescribeFields(report.fields);
+    EXPECT_GT(report.compared, 0);
+    EXPECT_EQ(report.compared + report.skipped, options.casesPerOpcode);
+  }
+}
+
+// Test naming the fields of a mismatch
+TEST(TestDifferential, TestDescribeFields) {
+  EXPECT_EQ(HCS08::DescribeFields(0), "");
+  EXPECT_EQ(HCS08::DescribeFields(HCS08::DiffFields::A |
+                                  HCS08::DiffFields::MEMORY),
+            "a memory");
+  EXPECT_EQ(HCS08::DescribeFields(
+                HCS08::DiffFields::PC |
+                1 << (HCS08::DiffFields::FLAG_SHIFT + HCS08::Flags::FLAG_C) |
+                1 << (HCS08::DiffFields::FLAG_SHIFT + HCS08::Flags::FLAG_V)),
+            "pc flag.c flag.v");
+}
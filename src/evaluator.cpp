@@ -0,0 +1,642 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "evaluator.h"
+
+#include <binaryninjaapi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+namespace {
+constexpr uint64_t Mask(const size_t size) {
+  return size == 0 || size >= 8 ? UINT64_MAX : (1ULL << size * 8) - 1;
+}
+
+constexpr uint64_t SignBit(const size_t size) {
+  return size == 0 || size >= 8 ? 1ULL << 63 : 1ULL << (size * 8 - 1);
+}
+
+constexpr int64_t Signed(const uint64_t value, const size_t size) {
+  const uint64_t sign = SignBit(size);
+  return static_cast<int64_t>(((value & Mask(size)) ^ sign) - sign);
+}
+
+// Which operands of an operation are expressions, as a bit per operand
+uint8_t ExpressionOperands(const BNLowLevelILOperation operation) {
+  switch (operation) {
+    case LLIL_SET_REG:
+    case LLIL_SET_FLAG:
+      return 0b0010;
+    case LLIL_SET_REG_SPLIT:
+      return 0b0100;
+    case LLIL_LOAD:
+    case LLIL_PUSH:
+    case LLIL_NEG:
+    case LLIL_NOT:
+    case LLIL_SX:
+    case LLIL_ZX:
+    case LLIL_LOW_PART:
+    case LLIL_BOOL_TO_INT:
+    case LLIL_JUMP:
+    case LLIL_CALL:
+    case LLIL_TAILCALL:
+    case LLIL_RET:
+    case LLIL_IF:
+      return 0b0001;
+    case LLIL_STORE:
+    case LLIL_ADD:
+    case LLIL_SUB:
+    case LLIL_AND:
+    case LLIL_OR:
+    case LLIL_XOR:
+    case LLIL_LSL:
+    case LLIL_LSR:
+    case LLIL_ASR:
+    case LLIL_ROL:
+    case LLIL_ROR:
+    case LLIL_MUL:
+    case LLIL_MULU_DP:
+    case LLIL_DIVU:
+    case LLIL_DIVU_DP:
+    case LLIL_MODU:
+    case LLIL_MODU_DP:
+    case LLIL_CMP_E:
+    case LLIL_CMP_NE:
+    case LLIL_CMP_SLT:
+    case LLIL_CMP_ULT:
+    case LLIL_CMP_SLE:
+    case LLIL_CMP_ULE:
+    case LLIL_CMP_SGE:
+    case LLIL_CMP_UGE:
+    case LLIL_CMP_SGT:
+    case LLIL_CMP_UGT:
+    case LLIL_TEST_BIT:
+      return 0b0011;
+    case LLIL_ADC:
+    case LLIL_SBB:
+    case LLIL_RLC:
+    case LLIL_RRC:
+      return 0b0111;
+    default:
+      return 0;
+  }
+}
+
+uint32_t Copy(BN::LowLevelILFunction& il, const size_t index,
+              IlProgram& program) {
+  const BN::LowLevelILInstruction source = il.GetExpr(index);
+  IlExpr expr = {source.operation,
+                 static_cast<uint8_t>(source.size),
+                 source.flags,
+                 {source.operands[0], source.operands[1], source.operands[2],
+                  source.operands[3]}};
+  const uint8_t children = ExpressionOperands(expr.operation);
+  for (size_t i = 0; i < expr.operands.size(); i++) {
+    if ((children >> i & 1) != 0) {
+      expr.operands[i] = Copy(il, expr.operands[i], program);
+    }
+  }
+  program.exprs.push_back(expr);
+  return static_cast<uint32_t>(program.exprs.size() - 1);
+}
+
+// The bit a rotate or shift by count moved out of value last, or -1 if none
+int ShiftedOut(const BNLowLevelILOperation operation, const uint64_t value,
+               const uint64_t count, const size_t size) {
+  const uint64_t bits = size * 8;
+  if (count == 0 || count > bits) {
+    return -1;
+  }
+  switch (operation) {
+    case LLIL_LSL:
+      return static_cast<int>(value >> (bits - count) & 1);
+    case LLIL_LSR:
+    case LLIL_ASR:
+      return static_cast<int>(value >> (count - 1) & 1);
+    default:
+      return -1;
+  }
+}
+}  // namespace
+
+/**
+ * CompileIl - Copy the IL of one lifted instruction out of a function
+ * @param il          - function holding only that instruction's IL
+ * @param fallthrough - address of the next instruction
+ * @param program     - receives the expressions
+ * @return false if the function is empty
+ */
+bool CompileIl(BN::LowLevelILFunction& il, const uint16_t fallthrough,
+               IlProgram& program) {
+  program.exprs.clear();
+  program.instructions.clear();
+  program.fallthrough = fallthrough;
+  for (size_t i = 0; i < il.GetInstructionCount(); i++) {
+    program.instructions.push_back(
+        Copy(il, il.GetIndexForInstruction(i), program));
+  }
+  return !program.instructions.empty();
+}
+
+IlEvaluator::IlEvaluator(BN::Architecture* arch)
+    : STACK_POINTER(arch->GetStackPointerRegister()) {
+  for (const uint32_t reg : arch->GetAllRegisters()) {
+    if (reg < REGISTERS.size()) {
+      const BNRegisterInfo info = arch->GetRegisterInfo(reg);
+      REGISTERS[reg] = {static_cast<uint8_t>(info.fullWidthRegister),
+                        static_cast<uint8_t>(info.offset * 8),
+                        static_cast<uint8_t>(info.size)};
+    }
+  }
+  // Flag write type 0 writes no flags
+  for (size_t type = 1; type < FLAG_WRITES.size(); type++) {
+    for (const uint32_t flag : arch->GetFlagsWrittenByFlagWriteType(type)) {
+      FLAG_WRITES[type] |= 1 << flag;
+    }
+  }
+  ROLES.fill(SpecialFlagRole);
+  for (const uint32_t flag : arch->GetAllFlags()) {
+    if (flag < ROLES.size()) {
+      ROLES[flag] = arch->GetFlagRole(flag, 0);
+    }
+  }
+}
+
+bool IlEvaluator::KnownRegister(const uint32_t reg) const {
+  if (LLIL_REG_IS_TEMP(reg)) {
+    return LLIL_GET_TEMP_REG_INDEX(reg) < IlMachine::TEMP_COUNT;
+  }
+  return reg < REGISTERS.size() && REGISTERS[reg].size != 0;
+}
+
+uint64_t IlEvaluator::GetRegister(const IlMachine& machine,
+                                  const uint32_t reg) const {
+  if (LLIL_REG_IS_TEMP(reg)) {
+    return machine.temps[LLIL_GET_TEMP_REG_INDEX(reg)];
+  }
+  const RegisterSlot& slot = REGISTERS[reg];
+  return machine.registers[slot.full] >> slot.shift & Mask(slot.size);
+}
+
+void IlEvaluator::SetRegister(IlMachine& machine, const uint32_t reg,
+                              const uint64_t value) const {
+  if (LLIL_REG_IS_TEMP(reg)) {
+    machine.temps[LLIL_GET_TEMP_REG_INDEX(reg)] = value;
+    return;
+  }
+  const RegisterSlot& slot = REGISTERS[reg];
+  const uint64_t mask = Mask(slot.size) << slot.shift;
+  uint64_t& full = machine.registers[slot.full];
+  full = (full & ~mask) | (value << slot.shift & mask);
+}
+
+uint64_t IlEvaluator::Load(IlMachine& machine, const uint16_t addr,
+                           const size_t size) const {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; i++) {
+    const uint16_t byte = static_cast<uint16_t>(addr + i);
+    uint8_t data = machine.memory[byte];
+    for (auto it = machine.writes.rbegin(); it != machine.writes.rend();
+         ++it) {
+      if (it->first == byte) {
+        data = it->second;
+        break;
+      }
+    }
+    value = value << 8 | data;
+  }
+  return value;
+}
+
+void IlEvaluator::Store(IlMachine& machine, const uint16_t addr,
+                        const size_t size, const uint64_t value) const {
+  for (size_t i = 0; i < size; i++) {
+    machine.writes.emplace_back(static_cast<uint16_t>(addr + i),
+                                value >> (size - 1 - i) * 8 & 0xFF);
+  }
+}
+
+bool IlEvaluator::ReadFlag(Context& context, const uint32_t flag) const {
+  if ((context.machine.undefinedFlags >> flag & 1) != 0) {
+    context.outcome = IlOutcome::UNDEFINED;
+  }
+  return (context.machine.flags >> flag & 1) != 0;
+}
+
+/**
+ * Condition - Evaluate a flag condition from the flags holding each role
+ * @param context   - evaluation in progress
+ * @param condition - LLFC_* condition
+ * @return whether the condition holds
+ */
+bool IlEvaluator::Condition(Context& context,
+                            const BNLowLevelILFlagCondition condition) const {
+  const auto role = [&](const BNFlagRole wanted) {
+    for (size_t flag = 0; flag < ROLES.size(); flag++) {
+      if (ROLES[flag] == wanted) {
+        return ReadFlag(context, flag);
+      }
+    }
+    context.outcome = IlOutcome::UNSUPPORTED;
+    return false;
+  };
+  switch (condition) {
+    case LLFC_E:
+      return role(ZeroFlagRole);
+    case LLFC_NE:
+      return !role(ZeroFlagRole);
+    case LLFC_ULT:
+      return role(CarryFlagRole);
+    case LLFC_UGE:
+      return !role(CarryFlagRole);
+    case LLFC_ULE:
+      return role(CarryFlagRole) || role(ZeroFlagRole);
+    case LLFC_UGT:
+      return !role(CarryFlagRole) && !role(ZeroFlagRole);
+    case LLFC_SLT:
+      return role(NegativeSignFlagRole) != role(OverflowFlagRole);
+    case LLFC_SGE:
+      return role(NegativeSignFlagRole) == role(OverflowFlagRole);
+    case LLFC_SLE:
+      return role(ZeroFlagRole) ||
+             role(NegativeSignFlagRole) != role(OverflowFlagRole);
+    case LLFC_SGT:
+      return !role(ZeroFlagRole) &&
+             role(NegativeSignFlagRole) == role(OverflowFlagRole);
+    case LLFC_NEG:
+      return role(NegativeSignFlagRole);
+    case LLFC_POS:
+      return !role(NegativeSignFlagRole);
+    case LLFC_O:
+      return role(OverflowFlagRole);
+    case LLFC_NO:
+      return !role(OverflowFlagRole);
+    default:
+      context.outcome = IlOutcome::UNSUPPORTED;
+      return false;
+  }
+}
+
+/**
+ * WriteFlags - Set the flags an operation's flag write type names from the
+ * operands and result of the operation
+ * @param context - evaluation in progress
+ * @param expr    - the operation
+ * @param left    - first operand
+ * @param right   - second operand, or 0
+ * @param carry   - carry in of ADC, SBB, RLC and RRC, or 0
+ * @param result  - result, already masked to the operation size
+ */
+void IlEvaluator::WriteFlags(Context& context, const IlExpr& expr,
+                             const uint64_t left, const uint64_t right,
+                             const uint64_t carry,
+                             const uint64_t result) const {
+  const uint8_t written = FLAG_WRITES[expr.flags & 0xFF];
+  const uint64_t sign = SignBit(expr.size);
+  IlMachine& machine = context.machine;
+  for (size_t flag = 0; flag < ROLES.size(); flag++) {
+    if ((written >> flag & 1) == 0) {
+      continue;
+    }
+    int value = -1;
+    switch (ROLES[flag]) {
+      case ZeroFlagRole:
+        value = result == 0;
+        break;
+      case NegativeSignFlagRole:
+        value = (result & sign) != 0;
+        break;
+      case CarryFlagRole:
+        switch (expr.operation) {
+          case LLIL_ADD:
+          case LLIL_ADC:
+            value = result < left || (carry != 0 && result == left);
+            break;
+          case LLIL_SUB:
+          case LLIL_SBB:
+            value = left < right || (carry != 0 && left == right);
+            break;
+          case LLIL_NEG:
+            value = left != 0;
+            break;
+          case LLIL_RLC:
+            value = (left & sign) != 0;
+            break;
+          case LLIL_RRC:
+            value = static_cast<int>(left & 1);
+            break;
+          default:
+            value = ShiftedOut(expr.operation, left, right, expr.size);
+            break;
+        }
+        break;
+      case OverflowFlagRole:
+        switch (expr.operation) {
+          case LLIL_ADD:
+          case LLIL_ADC:
+            value = ((left ^ result) & (right ^ result) & sign) != 0;
+            break;
+          case LLIL_SUB:
+          case LLIL_SBB:
+            value = ((left ^ right) & (left ^ result) & sign) != 0;
+            break;
+          case LLIL_NEG:
+            value = left == sign;
+            break;
+          default:
+            break;
+        }
+        break;
+      default:
+        break;
+    }
+    const uint8_t bit = 1 << flag;
+    if (value < 0) {
+      machine.undefinedFlags |= bit;
+    } else {
+      machine.undefinedFlags &= ~bit;
+      machine.flags = value != 0 ? machine.flags | bit : machine.flags & ~bit;
+    }
+  }
+}
+
+/**
+ * Evaluate - Evaluate one expression, with its side effects
+ * @param context - evaluation in progress; outcome is set on failure
+ * @param index   - expression index in the program
+ * @return value of the expression, masked to its size
+ */
+uint64_t IlEvaluator::Evaluate(Context& context, const uint32_t index) const {
+  const IlExpr& expr = context.program.exprs[index];
+  IlMachine& machine = context.machine;
+  const uint64_t mask = Mask(expr.size);
+  const auto operand = [&](const size_t i) {
+    return Evaluate(context, static_cast<uint32_t>(expr.operands[i]));
+  };
+  const auto operandSize = [&](const size_t i) {
+    return context.program.exprs[expr.operands[i]].size;
+  };
+
+  switch (expr.operation) {
+    case LLIL_NOP:
+      return 0;
+    case LLIL_CONST:
+    case LLIL_CONST_PTR:
+      return expr.operands[0] & mask;
+    case LLIL_REG:
+    case LLIL_SET_REG:
+      if (!KnownRegister(expr.operands[0])) {
+        context.outcome = IlOutcome::UNSUPPORTED;
+        return 0;
+      }
+      if (expr.operation == LLIL_REG) {
+        return GetRegister(machine, expr.operands[0]) & mask;
+      }
+      SetRegister(machine, expr.operands[0], operand(1) & mask);
+      return 0;
+    case LLIL_FLAG:
+      return ReadFlag(context, expr.operands[0]);
+    case LLIL_SET_FLAG: {
+      const uint8_t bit = 1 << expr.operands[0];
+      machine.undefinedFlags &= ~bit;
+      machine.flags =
+          operand(1) != 0 ? machine.flags | bit : machine.flags & ~bit;
+      return 0;
+    }
+    case LLIL_FLAG_COND:
+      return Condition(
+          context, static_cast<BNLowLevelILFlagCondition>(expr.operands[0]));
+    case LLIL_LOAD:
+      return Load(machine, operand(0), expr.size);
+    case LLIL_STORE: {
+      const uint16_t addr = operand(0);
+      Store(machine, addr, expr.size, operand(1));
+      return 0;
+    }
+    case LLIL_PUSH: {
+      const uint64_t value = operand(0);
+      const uint16_t sp = GetRegister(machine, STACK_POINTER) - expr.size;
+      SetRegister(machine, STACK_POINTER, sp);
+      Store(machine, sp, expr.size, value);
+      return 0;
+    }
+    case LLIL_POP: {
+      const uint16_t sp = GetRegister(machine, STACK_POINTER);
+      SetRegister(machine, STACK_POINTER, sp + expr.size);
+      return Load(machine, sp, expr.size);
+    }
+
+    case LLIL_ADD:
+    case LLIL_ADC:
+    case LLIL_SUB:
+    case LLIL_SBB: {
+      const uint64_t left = operand(0) & mask;
+      const uint64_t right = operand(1) & mask;
+      const uint64_t carry =
+          expr.operation == LLIL_ADC || expr.operation == LLIL_SBB
+              ? operand(2) & 1
+              : 0;
+      const bool add =
+          expr.operation == LLIL_ADD || expr.operation == LLIL_ADC;
+      const uint64_t result =
+          (add ? left + right + carry : left - right - carry) & mask;
+      WriteFlags(context, expr, left, right, carry, result);
+      return result;
+    }
+    case LLIL_AND:
+    case LLIL_OR:
+    case LLIL_XOR:
+    case LLIL_MUL: {
+      const uint64_t left = operand(0) & mask;
+      const uint64_t right = operand(1) & mask;
+      const uint64_t result =
+          (expr.operation == LLIL_AND  ? left & right
+           : expr.operation == LLIL_OR ? left | right
+           : expr.operation == LLIL_XOR
+               ? left ^ right
+               : left * right) &
+          mask;
+      WriteFlags(context, expr, left, right, 0, result);
+      return result;
+    }
+    case LLIL_LSL:
+    case LLIL_LSR:
+    case LLIL_ASR: {
+      const uint64_t left = operand(0) & mask;
+      const uint64_t count = operand(1);
+      const uint64_t bits = expr.size * 8;
+      uint64_t result;
+      if (expr.operation == LLIL_LSL) {
+        result = count >= bits ? 0 : left << count & mask;
+      } else if (expr.operation == LLIL_LSR) {
+        result = count >= bits ? 0 : left >> count;
+      } else {
+        const int64_t value = Signed(left, expr.size);
+        result = static_cast<uint64_t>(value >> (count >= bits ? bits - 1
+                                                               : count)) &
+                 mask;
+      }
+      WriteFlags(context, expr, left, count, 0, result);
+      return result;
+    }
+    case LLIL_ROL:
+    case LLIL_ROR:
+    case LLIL_RLC:
+    case LLIL_RRC: {
+      const uint64_t left = operand(0) & mask;
+      const uint64_t count = operand(1);
+      const bool throughCarry =
+          expr.operation == LLIL_RLC || expr.operation == LLIL_RRC;
+      const uint64_t carry = throughCarry ? operand(2) & 1 : 0;
+      const bool leftward =
+          expr.operation == LLIL_ROL || expr.operation == LLIL_RLC;
+      if (count != 1) {
+        context.outcome = IlOutcome::UNSUPPORTED;
+        return 0;
+      }
+      const uint64_t in = throughCarry ? carry
+                          : leftward   ? left >> (expr.size * 8 - 1) & 1
+                                       : left & 1;
+      const uint64_t result =
+          leftward ? (left << 1 | in) & mask
+                   : left >> 1 | (in != 0 ? SignBit(expr.size) : 0);
+      WriteFlags(context, expr, left, count, carry, result);
+      return result;
+    }
+    case LLIL_MULU_DP:
+      return (operand(0) & mask) * (operand(1) & mask) & Mask(expr.size * 2);
+    case LLIL_DIVU:
+    case LLIL_DIVU_DP:
+    case LLIL_MODU:
+    case LLIL_MODU_DP: {
+      const uint64_t dividend = operand(0);
+      const uint64_t divisor = operand(1) & mask;
+      if (divisor == 0) {
+        context.outcome = IlOutcome::UNDEFINED;
+        return 0;
+      }
+      const bool quotient =
+          expr.operation == LLIL_DIVU || expr.operation == LLIL_DIVU_DP;
+      const uint64_t result =
+          (quotient ? dividend / divisor : dividend % divisor) & mask;
+      WriteFlags(context, expr, dividend, divisor, 0, result);
+      return result;
+    }
+    case LLIL_NEG:
+    case LLIL_NOT: {
+      const uint64_t value = operand(0) & mask;
+      const uint64_t result =
+          (expr.operation == LLIL_NEG ? 0 - value : ~value) & mask;
+      WriteFlags(context, expr, value, 0, 0, result);
+      return result;
+    }
+    case LLIL_SX:
+      return static_cast<uint64_t>(Signed(operand(0), operandSize(0))) & mask;
+    case LLIL_ZX:
+    case LLIL_LOW_PART:
+      return operand(0) & Mask(operandSize(0)) & mask;
+    case LLIL_BOOL_TO_INT:
+      return operand(0) != 0;
+    case LLIL_TEST_BIT:
+      return (operand(0) >> operand(1) & 1) != 0;
+    case LLIL_CMP_E:
+    case LLIL_CMP_NE:
+    case LLIL_CMP_ULT:
+    case LLIL_CMP_ULE:
+    case LLIL_CMP_UGE:
+    case LLIL_CMP_UGT:
+    case LLIL_CMP_SLT:
+    case LLIL_CMP_SLE:
+    case LLIL_CMP_SGE:
+    case LLIL_CMP_SGT: {
+      const uint64_t left = operand(0) & mask;
+      const uint64_t right = operand(1) & mask;
+      const int64_t sl = Signed(left, expr.size);
+      const int64_t sr = Signed(right, expr.size);
+      switch (expr.operation) {
+        case LLIL_CMP_E:
+          return left == right;
+        case LLIL_CMP_NE:
+          return left != right;
+        case LLIL_CMP_ULT:
+          return left < right;
+        case LLIL_CMP_ULE:
+          return left <= right;
+        case LLIL_CMP_UGE:
+          return left >= right;
+        case LLIL_CMP_UGT:
+          return left > right;
+        case LLIL_CMP_SLT:
+          return sl < sr;
+        case LLIL_CMP_SLE:
+          return sl <= sr;
+        case LLIL_CMP_SGE:
+          return sl >= sr;
+        default:
+          return sl > sr;
+      }
+    }
+    case LLIL_UNIMPL:
+    case LLIL_UNIMPL_MEM:
+      context.outcome = IlOutcome::UNIMPLEMENTED;
+      return 0;
+    case LLIL_UNDEF:
+      context.outcome = IlOutcome::UNDEFINED;
+      return 0;
+    default:
+      context.outcome = IlOutcome::UNSUPPORTED;
+      return 0;
+  }
+}
+
+/**
+ * Run - Evaluate a lifted instruction on a machine state
+ * @param program - IL of the instruction
+ * @param machine - state to update; pc is set to where execution continues
+ * @return OK if the whole instruction was evaluated
+ */
+IlOutcome IlEvaluator::Run(const IlProgram& program,
+                           IlMachine& machine) const {
+  Context context = {program, machine, IlOutcome::OK};
+  machine.pc = program.fallthrough;
+  machine.called = false;
+  size_t next = 0;
+  for (size_t steps = 0; next < program.instructions.size(); steps++) {
+    if (steps == MAX_STEPS) {
+      return IlOutcome::UNSUPPORTED;
+    }
+    const uint32_t root = program.instructions[next++];
+    const IlExpr& expr = program.exprs[root];
+    switch (expr.operation) {
+      case LLIL_JUMP:
+      case LLIL_TAILCALL:
+      case LLIL_RET:
+        machine.pc = Evaluate(context, expr.operands[0]);
+        return context.outcome;
+      case LLIL_CALL:
+        machine.pc = Evaluate(context, expr.operands[0]);
+        machine.called = true;
+        return context.outcome;
+      case LLIL_IF:
+        next = Evaluate(context, expr.operands[0]) != 0 ? expr.operands[1]
+                                                        : expr.operands[2];
+        break;
+      case LLIL_GOTO:
+        next = expr.operands[0];
+        break;
+      default:
+        Evaluate(context, root);
+        break;
+    }
+    if (context.outcome != IlOutcome::OK) {
+      return context.outcome;
+    }
+  }
+  return context.outcome;
+}
+}  // namespace HCS08
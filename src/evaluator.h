@@ -0,0 +1,119 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_EVALUATOR_H
+#define HCS08_EVALUATOR_H
+
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+// One expression copied out of a LowLevelILFunction. Operands that are
+// expressions hold indices into IlProgram::exprs; IF and GOTO targets stay
+// instruction indices.
+struct IlExpr {
+  BNLowLevelILOperation operation;
+  uint8_t size;
+  uint32_t flags;
+  std::array<uint64_t, 4> operands;
+};
+
+/*
+ * The IL of one lifted instruction in a flat, self-contained form, so it can
+ * be evaluated many times without calling into the Binary Ninja core.
+ */
+struct IlProgram {
+  std::vector<IlExpr> exprs;
+  std::vector<uint32_t> instructions;  // root expression of each instruction
+  uint16_t fallthrough = 0;            // address of the next instruction
+};
+
+bool CompileIl(BN::LowLevelILFunction& il, uint16_t fallthrough,
+               IlProgram& program);
+
+// How IlEvaluator::Run ended
+enum class IlOutcome : uint8_t {
+  OK,             // ran to a jump, call, return or off the end
+  UNIMPLEMENTED,  // reached an UNIMPL expression
+  UNDEFINED,      // reached UNDEF, or read a flag whose value is unknown
+  UNSUPPORTED,    // an operation the evaluator does not model
+};
+
+/*
+ * Machine state the IL runs on. Registers are stored by full-width register
+ * id and flags as a CCR-style bit mask (flag ids are CCR bit numbers). Loads
+ * read memory, which is not modified: stores go to writes, which later loads
+ * see.
+ */
+struct IlMachine {
+  static constexpr size_t REGISTER_COUNT = 8;
+  static constexpr size_t TEMP_COUNT = 4;  // LLIL_TEMP(0) to LLIL_TEMP(3)
+
+  std::array<uint64_t, REGISTER_COUNT> registers{};
+  std::array<uint64_t, TEMP_COUNT> temps{};
+  uint8_t flags = 0;
+  uint8_t undefinedFlags = 0;  // written, but not derivable from their role
+  uint16_t pc = 0;             // where execution continues
+  bool called = false;         // ended in a CALL
+  const uint8_t* memory = nullptr;
+  std::vector<std::pair<uint16_t, uint8_t>> writes;
+};
+
+/*
+ * A small LLIL interpreter for the expressions the lifter emits. Register
+ * layout, flag write types and flag roles come from the architecture, so the
+ * IL is evaluated as Binary Ninja would read it: a flag written by an
+ * operation takes the value its role gives that operation (carry out, zero,
+ * sign, signed overflow), and a role the operation does not define leaves the
+ * flag undefined rather than guessed. Memory is big-endian and PUSH and POP
+ * move SP before and after the access, as Binary Ninja does. The return
+ * address of a CALL is left to the core, so CALL only sets pc and called.
+ */
+class IlEvaluator {
+ public:
+  explicit IlEvaluator(BN::Architecture* arch);
+
+  IlOutcome Run(const IlProgram& program, IlMachine& machine) const;
+
+ private:
+  static constexpr size_t FLAG_COUNT = 8;
+  static constexpr size_t MAX_STEPS = 64;
+
+  struct RegisterSlot {
+    uint8_t full;
+    uint8_t shift;  // bit offset within the full-width register
+    uint8_t size;
+  };
+
+  struct Context {
+    const IlProgram& program;
+    IlMachine& machine;
+    IlOutcome outcome;
+  };
+
+  uint64_t Evaluate(Context& context, uint32_t index) const;
+  void WriteFlags(Context& context, const IlExpr& expr, uint64_t left,
+                  uint64_t right, uint64_t carry, uint64_t result) const;
+  bool Condition(Context& context, BNLowLevelILFlagCondition condition) const;
+  bool ReadFlag(Context& context, uint32_t flag) const;
+  uint64_t Load(IlMachine& machine, uint16_t addr, size_t size) const;
+  void Store(IlMachine& machine, uint16_t addr, size_t size,
+             uint64_t value) const;
+  bool KnownRegister(uint32_t reg) const;
+  uint64_t GetRegister(const IlMachine& machine, uint32_t reg) const;
+  void SetRegister(IlMachine& machine, uint32_t reg, uint64_t value) const;
+
+  std::array<RegisterSlot, IlMachine::REGISTER_COUNT> REGISTERS{};
+  std::array<uint8_t, 256> FLAG_WRITES{};  // flag mask by flag write type
+  std::array<BNFlagRole, FLAG_COUNT> ROLES{};
+  uint32_t STACK_POINTER;
+};
+}  // namespace HCS08
+
+#endif  // HCS08_EVALUATOR_H
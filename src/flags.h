@@ -28,11 +28,13 @@ constexpr uint8_t FLAG_V = 7;  // Two's complement overflow
 /* -------------- */
 /* Flag groupings */
 /* -------------- */
-constexpr uint8_t FLAGS_Z_N_V = 0;
-constexpr uint8_t FLAGS_C_Z_N_V = 1;
-constexpr uint8_t FLAGS_C_Z_N_H_V = 2;
-constexpr uint8_t FLAGS_Z = 3;
-constexpr uint8_t FLAGS_C_Z = 4;
+/* Flag write type 0 means "no flags" to Binary Ninja, so groups start at 1 */
+constexpr uint8_t FLAGS_Z_N_V = 1;
+constexpr uint8_t FLAGS_C_Z_N_V = 2;
+constexpr uint8_t FLAGS_C_Z_N_H_V = 3;
+constexpr uint8_t FLAGS_Z = 4;
+constexpr uint8_t FLAGS_C_Z = 5;
+constexpr uint8_t FLAGS_NONE = 0xFF;  // Instruction does not write flags
 }  // namespace HCS08::Flags
 
 #endif  // HCS08_FLAGS_H
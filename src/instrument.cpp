@@ -0,0 +1,275 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "instrument.h"
+
+#ifdef HCS08_INSTRUMENT
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "descriptors.h"
+#include "opcodes.h"
+
+namespace HCS08::Instrument {
+namespace {
+constexpr const char* FAILURE_NAMES[FAILURE_COUNT] = {
+    "undefined opcode", "truncated", "text", "lift"};
+
+// Threads that can register without growing Registry::live
+constexpr size_t THREAD_CAPACITY = 256;
+
+void RetireThread(void* counters);
+
+#ifdef _WIN32
+void NTAPI RetireFiber(void* counters) { RetireThread(counters); }
+#endif
+
+/*
+ * Counters of every live thread plus the merged counters of threads that
+ * have exited. Allocated once and never freed so threads that exit during
+ * static destruction can still retire their counters. The registry is built
+ * when the library loads, with room for THREAD_CAPACITY threads and a
+ * thread-exit key that retires a thread's counters, so the first
+ * instrumented callback on a thread does not allocate. A thread_local with a
+ * destructor would not do: registering its destructor allocates.
+ */
+struct Registry {
+  std::mutex lock;
+  std::vector<Counters*> live;
+  Counters retired;
+#ifdef _WIN32
+  DWORD exitKey = FlsAlloc(RetireFiber);
+#else
+  pthread_key_t exitKey{};
+  bool hasExitKey = pthread_key_create(&exitKey, RetireThread) == 0;
+#endif
+
+  Registry() { live.reserve(THREAD_CAPACITY); }
+
+  /**
+   * Register - Add a thread's counters and retire them when it exits
+   * @param counters - the calling thread's counters
+   */
+  void Register(Counters* counters) {
+    {
+      std::lock_guard guard(lock);
+      live.push_back(counters);
+    }
+#ifdef _WIN32
+    if (exitKey != FLS_OUT_OF_INDEXES) {
+      FlsSetValue(exitKey, counters);
+    }
+#else
+    if (hasExitKey) {
+      pthread_setspecific(exitKey, counters);
+    }
+#endif
+  }
+};
+
+Registry& GetRegistry() {
+  static Registry* registry = new Registry;
+  return *registry;
+}
+
+const Registry& LOAD_REGISTRY = GetRegistry();
+
+// Merge the counters of an exiting thread into Registry::retired
+void RetireThread(void* counters) {
+  Registry& registry = GetRegistry();
+  std::lock_guard lock(registry.lock);
+  registry.retired.Merge(*static_cast<Counters*>(counters));
+  std::erase(registry.live, static_cast<Counters*>(counters));
+}
+
+template <size_t N>
+void Clear(std::array<Counters::Counter, N>& counters) {
+  for (Counters::Counter& counter : counters) {
+    counter.store(0, std::memory_order_relaxed);
+  }
+}
+
+void Clear(Counters& counters) {
+  for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+    Clear(counters.calls[callback]);
+    Clear(counters.latency[callback]);
+  }
+  Clear(counters.failures);
+}
+
+uint64_t Read(const Counters::Counter& counter) {
+  return counter.load(std::memory_order_relaxed);
+}
+
+void DumpOpcodes(std::ostream& out, const Counters& counters) {
+  std::vector<std::pair<uint64_t, size_t>> rows;
+  for (size_t slot = 0; slot < OPCODE_SLOTS; slot++) {
+    uint64_t total = 0;
+    for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+      total += Read(counters.calls[callback][slot]);
+    }
+    if (total > 0) {
+      rows.emplace_back(total, slot);
+    }
+  }
+  std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+  });
+
+  out << "opcode  mnemonic        info        text        lift\n";
+  for (const auto& [_, slot] : rows) {
+    const std::array<uint8_t, 2> bytes = {
+        static_cast<uint8_t>(slot > 0xFF ? OpcodeFields::EXT_OP : slot),
+        static_cast<uint8_t>(slot & 0xFF)};
+    const InstructionDescriptor* descriptor = LookupDescriptor(bytes.data());
+    out << std::hex << std::uppercase << std::setw(6)
+        << (slot > 0xFF ? OpcodeFields::EXT_OP << 8 | (slot & 0xFF) : slot)
+        << std::dec << "  " << std::left << std::setw(8)
+        << (descriptor ? MnemonicToStr(descriptor->mnemonic) : "?")
+        << std::right;
+    for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+      out << std::setw(12) << Read(counters.calls[callback][slot]);
+    }
+    out << "\n";
+  }
+}
+
+void DumpLatency(std::ostream& out, const Counters& counters) {
+  out << "latency (ns)            info        text        lift\n";
+  for (size_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+    uint64_t total = 0;
+    for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+      total += Read(counters.latency[callback][bucket]);
+    }
+    if (total == 0) {
+      continue;
+    }
+    out << "< " << std::left << std::setw(14) << (uint64_t{1} << bucket)
+        << std::right;
+    for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+      out << std::setw(12) << Read(counters.latency[callback][bucket]);
+    }
+    out << "\n";
+  }
+}
+
+/*
+ * Reports the counters when the plugin is unloaded or the process exits, to
+ * the file named by HCS08_INSTRUMENT_DUMP or to stderr
+ */
+struct UnloadDump {
+  ~UnloadDump() {
+    const char* path = std::getenv("HCS08_INSTRUMENT_DUMP");
+    if (path != nullptr) {
+      std::ofstream out(path);
+      Dump(out);
+    } else {
+      Dump(std::cerr);
+    }
+  }
+} UNLOAD_DUMP;
+}  // namespace
+
+void Counters::Merge(const Counters& other) {
+  for (size_t callback = 0; callback < CALLBACK_COUNT; callback++) {
+    for (size_t slot = 0; slot < OPCODE_SLOTS; slot++) {
+      Bump(calls[callback][slot], Read(other.calls[callback][slot]));
+    }
+    for (size_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+      Bump(latency[callback][bucket], Read(other.latency[callback][bucket]));
+    }
+  }
+  for (size_t reason = 0; reason < FAILURE_COUNT; reason++) {
+    Bump(failures[reason], Read(other.failures[reason]));
+  }
+}
+
+size_t CallTimer::LatencyBucket(const uint64_t ns) {
+  return std::min<size_t>(std::bit_width(ns), LATENCY_BUCKETS - 1);
+}
+
+size_t CallTimer::OpcodeSlot(const uint16_t opcode) {
+  return opcode >> 8 == OpcodeFields::EXT_OP ? 0x100 | (opcode & 0xFF)
+                                             : opcode & 0xFF;
+}
+
+/**
+ * Local returns the calling thread's counters, registering them on first use
+ * @return counters only this thread writes
+ */
+Counters& Local() {
+  // Counters is trivially destructible, so neither needs an exit handler
+  thread_local Counters counters;
+  thread_local bool registered = false;
+  if (!registered) {
+    registered = true;
+    GetRegistry().Register(&counters);
+  }
+  return counters;
+}
+
+/**
+ * Snapshot merges the counters of all live and exited threads
+ * @param total - counters the merged values are added to
+ */
+void Snapshot(Counters& total) {
+  Registry& registry = GetRegistry();
+  std::lock_guard lock(registry.lock);
+  total.Merge(registry.retired);
+  for (const Counters* counters : registry.live) {
+    total.Merge(*counters);
+  }
+}
+
+/**
+ * Reset zeroes all counters. Increments racing with the reset on other
+ * threads may survive it.
+ */
+void Reset() {
+  Registry& registry = GetRegistry();
+  std::lock_guard lock(registry.lock);
+  Clear(registry.retired);
+  for (Counters* counters : registry.live) {
+    Clear(*counters);
+  }
+}
+
+/**
+ * Dump writes a report of the merged counters: calls per opcode (busiest
+ * first), the latency histogram and failures by reason
+ * @param out - stream the report is written to
+ */
+void Dump(std::ostream& out) {
+  const auto total = std::make_unique<Counters>();
+  Snapshot(*total);
+
+  out << "HCS08 instrumentation\n";
+  DumpOpcodes(out, *total);
+  DumpLatency(out, *total);
+  out << "failures\n";
+  for (size_t reason = 0; reason < FAILURE_COUNT; reason++) {
+    out << "  " << std::left << std::setw(22) << FAILURE_NAMES[reason]
+        << std::right << Read(total->failures[reason]) << "\n";
+  }
+}
+}  // namespace HCS08::Instrument
+
+#endif  // HCS08_INSTRUMENT
@@ -0,0 +1,127 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_INSTRUMENT_H
+#define HCS08_INSTRUMENT_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "descriptors.h"
+
+/*
+ * Hot-path counters for the Architecture callbacks: calls per opcode, a log2
+ * latency histogram per callback and decode failures by reason. Everything
+ * here is an empty inline unless the library is built with the
+ * HCS08_INSTRUMENT CMake option, so the default build carries no cost.
+ */
+namespace HCS08::Instrument {
+#ifdef HCS08_INSTRUMENT
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+enum class Callback : uint8_t { INFO, TEXT, LIFT };
+constexpr size_t CALLBACK_COUNT = 3;
+
+enum class Failure : uint8_t {
+  UNDEFINED_OPCODE,  // no descriptor for the opcode byte(s)
+  TRUNCATED,         // fewer readable bytes than the instruction length
+  TEXT,              // TextFromDescriptor rejected the instruction
+  LIFT,              // Instruction::Lift rejected the instruction
+};
+constexpr size_t FAILURE_COUNT = 4;
+
+// Primary opcodes use slots 0x00-0xFF, 0x9E-prefixed ones 0x100-0x1FF
+constexpr size_t OPCODE_SLOTS = 0x200;
+
+// Bucket n counts calls that took [2^(n-1), 2^n) nanoseconds
+constexpr size_t LATENCY_BUCKETS = 32;
+
+/*
+ * One thread's counters. Only the owning thread writes them, so updates are
+ * relaxed load/store pairs rather than locked read-modify-writes; the atomics
+ * only make concurrent reads by Snapshot well defined.
+ */
+struct Counters {
+  using Counter = std::atomic<uint64_t>;
+
+  std::array<std::array<Counter, OPCODE_SLOTS>, CALLBACK_COUNT> calls{};
+  std::array<std::array<Counter, LATENCY_BUCKETS>, CALLBACK_COUNT> latency{};
+  std::array<Counter, FAILURE_COUNT> failures{};
+
+  static void Bump(Counter& counter, const uint64_t amount = 1) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount,
+                  std::memory_order_relaxed);
+  }
+
+  void Merge(const Counters& other);
+};
+
+#ifdef HCS08_INSTRUMENT
+Counters& Local();
+void Snapshot(Counters& total);
+void Reset();
+void Dump(std::ostream& out);
+
+inline void RecordFailure(const Failure reason) {
+  Counters::Bump(Local().failures[static_cast<size_t>(reason)]);
+}
+
+/*
+ * Times one callback from construction to destruction. The call is counted
+ * against the opcode given to SetOpcode; calls that fail to decode only show
+ * up in the latency histogram and the failure counts.
+ */
+class CallTimer {
+ public:
+  explicit CallTimer(const Callback callback)
+      : CALLBACK(static_cast<size_t>(callback)),
+        START(std::chrono::steady_clock::now()) {}
+
+  CallTimer(const CallTimer&) = delete;
+  CallTimer& operator=(const CallTimer&) = delete;
+
+  ~CallTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - START;
+    const auto ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    Counters& counters = Local();
+    Counters::Bump(counters.latency[CALLBACK][LatencyBucket(ns)]);
+    if (SLOT < OPCODE_SLOTS) {
+      Counters::Bump(counters.calls[CALLBACK][SLOT]);
+    }
+  }
+
+  void SetOpcode(const InstructionDescriptor& descriptor) {
+    SLOT = OpcodeSlot(descriptor.opcode);
+  }
+
+ private:
+  static size_t LatencyBucket(uint64_t ns);
+  static size_t OpcodeSlot(uint16_t opcode);
+
+  size_t CALLBACK;
+  size_t SLOT = OPCODE_SLOTS;
+  std::chrono::steady_clock::time_point START;
+};
+#else
+inline void Snapshot(Counters&) {}
+inline void Reset() {}
+inline void Dump(std::ostream&) {}
+inline void RecordFailure(Failure) {}
+
+class CallTimer {
+ public:
+  explicit CallTimer(Callback) {}
+  void SetOpcode(const InstructionDescriptor&) {}
+};
+#endif
+}  // namespace HCS08::Instrument
+
+#endif  // HCS08_INSTRUMENT_H
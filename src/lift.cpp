@@ -23,12 +23,6 @@ namespace BN = BinaryNinja;
       il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX), \
              il.Const(Sizes::BYTE, oprx8)),                                  \
       x)
-#define IX2_STORE(x)                                                         \
-  il.Store(                                                                  \
-      Sizes::BYTE,                                                           \
-      il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX), \
-             il.Const(Sizes::WORD, oprx16)),                                 \
-      x)
 #define SP_STORE(x) \
   il.Store(Sizes::BYTE, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), x)
 #define SP1_STORE(x)                                                         \
@@ -37,12 +31,6 @@ namespace BN = BinaryNinja;
       il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), \
              il.Const(Sizes::BYTE, oprx8)),                                  \
       x)
-#define SP2_STORE(x)                                                         \
-  il.Store(                                                                  \
-      Sizes::BYTE,                                                           \
-      il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), \
-             il.Const(Sizes::BYTE, oprx16)),                                 \
-      x)
 
 #define IX_STORE_WORD(x) \
   il.Store(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX), x)
@@ -70,7 +58,7 @@ namespace BN = BinaryNinja;
   il.Store(                                                                  \
       Sizes::WORD,                                                           \
       il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), \
-             il.Const(Sizes::BYTE, oprx16)),                                 \
+             il.Const(Sizes::WORD, oprx16)),                                 \
       x)
 
 #define IX_LOAD \
@@ -80,11 +68,6 @@ namespace BN = BinaryNinja;
       Sizes::BYTE,                                                           \
       il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX), \
              il.Const(Sizes::BYTE, oprx8)))
-#define IX2_LOAD                                                             \
-  il.Load(                                                                   \
-      Sizes::BYTE,                                                           \
-      il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX), \
-             il.Const(Sizes::WORD, oprx16)))
 #define SP_LOAD \
   il.Load(Sizes::BYTE, il.Register(Sizes::WORD, Registers::HCS08_REG_SP))
 #define SP1_LOAD                                                             \
@@ -92,11 +75,6 @@ namespace BN = BinaryNinja;
       Sizes::BYTE,                                                           \
       il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), \
              il.Const(Sizes::BYTE, oprx8)))
-#define SP2_LOAD                                                             \
-  il.Load(                                                                   \
-      Sizes::BYTE,                                                           \
-      il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_SP), \
-             il.Const(Sizes::BYTE, oprx16)))
 
 #define IX_LOAD_WORD \
   il.Load(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX))
@@ -121,200 +99,313 @@ namespace BN = BinaryNinja;
   return true;
 
 namespace HCS08 {
-/* Instruction Implementations */
-bool AdcDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                  Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-                  Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  il.Const(Sizes::BYTE, imm8), Flags::FLAG_C,
-                  Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  IX_LOAD, Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  IX1_LOAD, Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  IX2_LOAD, Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  SP1_LOAD, Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AdcSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.AddCarry(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                  SP2_LOAD, Flags::FLAG_C, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AddDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AddExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
-
-bool AddImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Const(Sizes::BYTE, imm8), Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
+namespace {
+// Instruction length of a register-memory or read-modify-write instruction
+constexpr size_t InstructionLength(const AddressingMode mode) {
+  switch (mode) {
+    case AddressingMode::IX:
+      return Sizes::INSTRUCTION_1_BYTE;
+    case AddressingMode::EXT:
+    case AddressingMode::IX2:
+    case AddressingMode::SP1:
+      return Sizes::INSTRUCTION_3_BYTES;
+    case AddressingMode::SP2:
+      return Sizes::INSTRUCTION_4_BYTES;
+    default:
+      return Sizes::INSTRUCTION_2_BYTES;
+  }
+}
+
+/**
+ * OperandAddress - Build the effective address of a memory operand
+ * @param mode   - addressing mode of the instruction
+ * @param opcode - instruction bytes
+ * @param il     - LowLevelILFunction the expression is added to
+ * @return ExprId of the 16-bit address
+ */
+BN::ExprId OperandAddress(const AddressingMode mode, const uint8_t* opcode,
+                          BN::LowLevelILFunction& il) {
+  switch (mode) {
+    case AddressingMode::DIR: {
+      // Opr8a is low byte of address in direct address space $0000-$00FF
+      uint8_t opr8a = opcode[1];
+      return il.ConstPointer(Sizes::WORD, opr8a);
+    }
+    case AddressingMode::EXT: {
+      // Opr16a is address anywhere in the 16-bit address space
+      uint16_t opr16a = opcode[1] << 8 | opcode[2];
+      return il.ConstPointer(Sizes::WORD, opr16a);
+    }
+    case AddressingMode::IX:
+      return il.Register(Sizes::WORD, Registers::HCS08_REG_HX);
+    case AddressingMode::IX1: {
+      // Oprx8 is 8-bit offset from index register H:X
+      int16_t oprx8 = opcode[1];
+      return il.Add(Sizes::WORD,
+                    il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
+                    il.Const(Sizes::BYTE, oprx8));
+    }
+    case AddressingMode::IX2: {
+      // Oprx16 is 16-bit offset from index register H:X
+      int16_t oprx16 = opcode[1] << 8 | opcode[2];
+      return il.Add(Sizes::WORD,
+                    il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
+                    il.Const(Sizes::WORD, oprx16));
+    }
+    case AddressingMode::SP1: {
+      // Oprx8 is 8-bit offset from stack pointer, after the 0x9E prefix
+      int16_t oprx8 = opcode[2];
+      return il.Add(Sizes::WORD,
+                    il.Register(Sizes::WORD, Registers::HCS08_REG_SP),
+                    il.Const(Sizes::BYTE, oprx8));
+    }
+    case AddressingMode::SP2: {
+      // Oprx16 is 16-bit offset from stack pointer, after the 0x9E prefix
+      int16_t oprx16 = opcode[2] << 8 | opcode[3];
+      return il.Add(Sizes::WORD,
+                    il.Register(Sizes::WORD, Registers::HCS08_REG_SP),
+                    il.Const(Sizes::WORD, oprx16));
+    }
+    default:
+      return il.Undefined();
+  }
+}
+
+/**
+ * OperandValue - Build the 8-bit operand of a register-memory instruction,
+ * either the immediate byte or a load from its effective address
+ * @param mode   - addressing mode of the instruction
+ * @param opcode - instruction bytes
+ * @param il     - LowLevelILFunction the expression is added to
+ * @return ExprId of the operand value
+ */
+BN::ExprId OperandValue(const AddressingMode mode, const uint8_t* opcode,
+                        BN::LowLevelILFunction& il) {
+  if (mode == AddressingMode::IMM) {
+    int8_t imm8 = opcode[1];
+    return il.Const(Sizes::BYTE, imm8);
+  }
+  return il.Load(Sizes::BYTE, OperandAddress(mode, opcode, il));
+}
+
+// Set N, Z and clear V from an 8-bit register, as loads and stores do
+BN::ExprId TestRegister(const uint32_t reg, BN::LowLevelILFunction& il) {
+  return il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, reg),
+                il.Const(Sizes::BYTE, 0), Flags::FLAGS_Z_N_V);
+}
+}  // namespace
+
+/**
+ * LiftAlu - Lift a register-memory instruction. The operand fetch is built
+ * once from the addressing mode and shared by every operation.
+ * @param op     - operation performed on the operand
+ * @param mode   - addressing mode of the operand
+ * @param opcode - instruction bytes
+ * @param len    - set to the length of the instruction
+ * @param il     - LowLevelILFunction to be populated
+ * @return bool indicating whether the instruction was lifted
+ */
+bool LiftAlu(const AluOp op, const AddressingMode mode, const uint8_t* opcode,
+             size_t& len, BN::LowLevelILFunction& il) {
+  len = InstructionLength(mode);
+  const uint32_t reg = op == AluOp::CPX || op == AluOp::LDX || op == AluOp::STX
+                           ? Registers::HCS08_REG_X
+                           : Registers::HCS08_REG_A;
+  switch (op) {
+    case AluOp::STA:
+    case AluOp::STX:
+      il.AddInstruction(TestRegister(reg, il));  // Set flags
+      il.AddInstruction(il.Store(Sizes::BYTE, OperandAddress(mode, opcode, il),
+                                 il.Register(Sizes::BYTE, reg)));
+      return true;
+    case AluOp::LDA:
+    case AluOp::LDX:
+      il.AddInstruction(
+          il.SetRegister(Sizes::BYTE, reg, OperandValue(mode, opcode, il)));
+      il.AddInstruction(TestRegister(reg, il));  // Set flags
+      return true;
+    default:
+      break;
+  }
 
-bool AddIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX_LOAD, Flags::FLAGS_C_Z_N_H_V)));
+  const BN::ExprId left = il.Register(Sizes::BYTE, reg);
+  const BN::ExprId right = OperandValue(mode, opcode, il);
+  switch (op) {
+    case AluOp::ADC:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.AddCarry(Sizes::BYTE, left, right, il.Flag(Flags::FLAG_C),
+                      Flags::FLAGS_C_Z_N_H_V)));
+      break;
+    case AluOp::ADD:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.Add(Sizes::BYTE, left, right, Flags::FLAGS_C_Z_N_H_V)));
+      break;
+    case AluOp::AND:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.And(Sizes::BYTE, left, right, Flags::FLAGS_Z_N_V)));
+      break;
+    case AluOp::BIT:
+      il.AddInstruction(il.And(Sizes::BYTE, left, right, Flags::FLAGS_Z_N_V));
+      break;
+    case AluOp::CMP:
+    case AluOp::CPX:
+      il.AddInstruction(il.Sub(Sizes::BYTE, left, right, Flags::FLAGS_C_Z_N_V));
+      break;
+    case AluOp::EOR:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.Xor(Sizes::BYTE, left, right, Flags::FLAGS_Z_N_V)));
+      break;
+    case AluOp::ORA:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.Or(Sizes::BYTE, left, right, Flags::FLAGS_Z_N_V)));
+      break;
+    case AluOp::SBC:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.SubBorrow(Sizes::BYTE, left, right, il.Flag(Flags::FLAG_C),
+                       Flags::FLAGS_C_Z_N_V)));
+      break;
+    case AluOp::SUB:
+      il.AddInstruction(il.SetRegister(
+          Sizes::BYTE, reg,
+          il.Sub(Sizes::BYTE, left, right, Flags::FLAGS_C_Z_N_V)));
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+/**
+ * LiftRmw - Lift a read-modify-write instruction on a memory operand. The
+ * operand fetch is shared by every operation.
+ * @param op     - operation applied to the operand
+ * @param mode   - addressing mode of the operand
+ * @param opcode - instruction bytes
+ * @param len    - set to the length of the instruction
+ * @param il     - LowLevelILFunction to be populated
+ * @return bool indicating whether the instruction was lifted
+ */
+bool LiftRmw(const RmwOp op, const AddressingMode mode, const uint8_t* opcode,
+             size_t& len, BN::LowLevelILFunction& il) {
+  len = InstructionLength(mode);
+  if (op == RmwOp::CLR) {
+    il.AddInstruction(il.Store(Sizes::BYTE, OperandAddress(mode, opcode, il),
+                               il.Const(Sizes::BYTE, 0)));
+    return true;
+  }
+
+  // The address is built separately for the load and the store so that no
+  // expression is shared between two parents
+  const BN::ExprId value =
+      il.Load(Sizes::BYTE, OperandAddress(mode, opcode, il));
+  BN::ExprId result;
+  switch (op) {
+    case RmwOp::ASR:
+      result = il.ArithShiftRight(Sizes::BYTE, value, il.Const(Sizes::BYTE, 1),
+                                  Flags::FLAGS_C_Z_N_V);
+      break;
+    case RmwOp::COM:
+      result = il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF), value,
+                      Flags::FLAGS_C_Z_N_V);
+      break;
+    case RmwOp::DEC:
+      result = il.Sub(Sizes::BYTE, value, il.Const(Sizes::BYTE, 1),
+                      Flags::FLAGS_Z_N_V);
+      break;
+    case RmwOp::INC:
+      result = il.Add(Sizes::BYTE, value, il.Const(Sizes::BYTE, 1),
+                      Flags::FLAGS_Z_N_V);
+      break;
+    case RmwOp::LSL:
+      result = il.ShiftLeft(Sizes::BYTE, value, il.Const(Sizes::BYTE, 1),
+                            Flags::FLAGS_C_Z_N_V);
+      break;
+    case RmwOp::LSR:
+      result = il.LogicalShiftRight(Sizes::BYTE, value,
+                                    il.Const(Sizes::BYTE, 1),
+                                    Flags::FLAGS_C_Z_N_V);
+      break;
+    case RmwOp::NEG:
+      result = il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0), value,
+                      Flags::FLAGS_C_Z_N_V);
+      break;
+    case RmwOp::ROL:
+      result = il.Or(Sizes::BYTE,
+                     il.ShiftLeft(Sizes::BYTE, value, il.Const(Sizes::BYTE, 7),
+                                  Flags::FLAGS_C_Z_N_V),
+                     il.Flag(Flags::FLAG_C));
+      break;
+    case RmwOp::ROR:
+      result = il.Or(
+          Sizes::BYTE,
+          il.LogicalShiftRight(Sizes::BYTE, value, il.Const(Sizes::BYTE, 1),
+                               Flags::FLAGS_C_Z_N_V),
+          il.ShiftLeft(Sizes::BYTE, il.Flag(Flags::FLAG_C),
+                       il.Const(Sizes::BYTE, 7)));
+      break;
+    case RmwOp::TST:
+      il.AddInstruction(il.Sub(Sizes::BYTE, value, il.Const(Sizes::BYTE, 0),
+                               Flags::FLAGS_Z_N_V));
+      return true;
+    default:
+      return false;
+  }
+  il.AddInstruction(
+      il.Store(Sizes::BYTE, OperandAddress(mode, opcode, il), result));
   return true;
 }
 
-bool AddIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX1_LOAD, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
-}
+BranchEmitter::BranchEmitter(BN::LowLevelILFunction& il,
+                             BN::Architecture* arch)
+    : IL(il), ARCH(arch) {}
 
-bool AddIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX2_LOAD, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
+/**
+ * Jump - Unconditional branch to a constant target
+ * @param target - branch target address
+ */
+void BranchEmitter::Jump(const uint64_t target) {
+  if (BNLowLevelILLabel* label = IL.GetLabelForAddress(ARCH, target)) {
+    IL.AddInstruction(IL.Goto(*label));
+    return;
+  }
+  IL.AddInstruction(IL.Jump(IL.ConstPointer(Sizes::WORD, target)));
 }
 
-bool AddSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP1_LOAD, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
+/**
+ * If - Conditional branch to a constant target
+ * @param condition   - IL expression selecting the taken path
+ * @param target      - branch target address when the condition holds
+ * @param fallthrough - address of the next instruction
+ */
+void BranchEmitter::If(const BN::ExprId condition, const uint64_t target,
+                       const uint64_t fallthrough) {
+  BN::LowLevelILLabel takenCode, nextCode;
+  BNLowLevelILLabel* taken = IL.GetLabelForAddress(ARCH, target);
+  BNLowLevelILLabel* next = IL.GetLabelForAddress(ARCH, fallthrough);
+  IL.AddInstruction(
+      IL.If(condition, taken ? *taken : takenCode, next ? *next : nextCode));
+  if (!taken) {
+    IL.MarkLabel(takenCode);
+    IL.AddInstruction(IL.Jump(IL.ConstPointer(Sizes::WORD, target)));
+  }
+  if (!next) {
+    // Falls through to the next instruction
+    IL.MarkLabel(nextCode);
+  }
 }
 
-bool AddSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Add(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP2_LOAD, Flags::FLAGS_C_Z_N_H_V)));
-  return true;
+uint16_t RelativeTarget(const uint64_t addr, const size_t len,
+                        const int8_t relOffset) {
+  return addr + len + relOffset;
 }
 
+/* Instruction Implementations */
 bool AisImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -351,102 +442,6 @@ bool AixImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Const(Sizes::BYTE, imm8), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX1_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX2_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP1_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool AndSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP2_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
 bool AsraInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -459,46 +454,6 @@ bool AsraInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AsrDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.ArithShiftRight(
-                   Sizes::BYTE,
-                   il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                   il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool AsrIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.ArithShiftRight(
-      Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool AsrIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.ArithShiftRight(
-      Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool AsrSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.ArithShiftRight(
-      Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
 bool AsrxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -614,101 +569,13 @@ bool BhiRel::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
 bool BihRel::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  return LiftBranchRel(opcode, addr, len, il, arch);
-}
-
-bool BilRel::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  return LiftBranchRel(opcode, addr, len, il, arch);
-}
-
-bool BitDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.And(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, imm8), Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX_LOAD, Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX1_LOAD, Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX2_LOAD, Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool BitSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           SP1_LOAD, Flags::FLAGS_Z_N_V));
-  return true;
+  return LiftBranchRel(opcode, addr, len, il, arch);
 }
 
-bool BitSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool BilRel::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.And(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           SP2_LOAD, Flags::FLAGS_Z_N_V));
-  return true;
+  return LiftBranchRel(opcode, addr, len, il, arch);
 }
 
 bool BleRel::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
@@ -945,48 +812,10 @@ bool CbeqaImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Compare operand against the accumulator
       il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
              il.Const(Sizes::BYTE, opr8i), Flags::FLAGS_C_Z_N_V));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1001,48 +830,10 @@ bool CbeqDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
       il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
              il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
              Flags::FLAGS_C_Z_N_V));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1060,48 +851,10 @@ bool CbeqIxPostinc::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
           Sizes::WORD, Registers::HCS08_REG_HX,
           il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
                  il.Const(Sizes::WORD, 1))));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1120,48 +873,10 @@ bool CbeqIx1Postinc::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
           Sizes::WORD, Registers::HCS08_REG_HX,
           il.Add(Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
                  il.Const(Sizes::WORD, 1))));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1175,48 +890,10 @@ bool CbeqxImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Compare operand against the accumulator
       il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
              il.Const(Sizes::BYTE, opr8i), Flags::FLAGS_C_Z_N_V));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1230,48 +907,10 @@ bool CbeqSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Compare operand against the accumulator
       il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
              SP1_LOAD, Flags::FLAGS_C_Z_N_V));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_E), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the operand and register are equal
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_E), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1298,15 +937,6 @@ bool ClraInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-                             il.Const(Sizes::BYTE, 0)));
-  return true;
-}
-
 bool ClrhInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -1316,30 +946,6 @@ bool ClrhInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.Const(Sizes::BYTE, 0)));
-  return true;
-}
-
-bool ClrIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Const(Sizes::BYTE, 0)));
-  return true;
-}
-
-bool ClrSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Const(Sizes::BYTE, 0)));
-  return true;
-}
-
 bool ClrxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -1350,94 +956,6 @@ bool ClrxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmpDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, imm8), Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX1_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           IX2_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           SP1_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CmpSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           SP2_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
 bool ComaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -1450,45 +968,6 @@ bool ComaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ComDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
-                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                      Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool ComIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
-                                    IX_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool ComIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
-                                     IX1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool ComSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
-                                     SP1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
 bool ComxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -1554,94 +1033,6 @@ bool CphxSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CpxDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, imm8), Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           IX_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           IX1_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           IX2_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           SP1_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
-bool CpxSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           SP2_LOAD, Flags::FLAGS_C_Z_N_V));
-  return true;
-}
-
 bool DaaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   UNIMPLEMENTED
@@ -1658,48 +1049,10 @@ bool DbnzaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
           Sizes::BYTE, Registers::HCS08_REG_A,
           il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
                  il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z)));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1711,52 +1064,14 @@ bool DbnzDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   int8_t relOffset =
       opcode[2];      // rel operand is used to calculate branch target
   il.AddInstruction(  // Decrement value stored at specified memory address
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Sub(Sizes::BYTE,
-                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                      il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z)));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
+               il.Sub(Sizes::BYTE,
+                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
+                      il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z)));
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1769,48 +1084,10 @@ bool DbnzIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Decrement value stored in indexed memory
       IX_STORE(il.Sub(Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1),
                       Flags::FLAGS_Z)));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1824,48 +1101,10 @@ bool DbnzIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Decrement value stored in indexed memory
       IX1_STORE(il.Sub(Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1),
                        Flags::FLAGS_Z)));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1879,48 +1118,10 @@ bool DbnzSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   il.AddInstruction(  // Decrement value stored in stack memory
       SP1_STORE(il.Sub(Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1),
                        Flags::FLAGS_Z)));
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1942,48 +1143,10 @@ bool DbnzxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                         il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
                         il.Const(Sizes::BYTE, 1),
                         Flags::FLAGS_Z))));  // X - 1; set Z flag
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-  // Branch if operand and accumulator register are not equal
-  il.AddInstruction(il.If(il.FlagCondition(LLFC_NE), true_label, false_label));
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
+  // Branch if the decremented value is not zero
+  BranchEmitter(il, arch)
+      .If(il.FlagCondition(LLFC_NE), RelativeTarget(addr, len, relOffset),
+          addr + len);
   return true;
 }
 
@@ -1998,45 +1161,6 @@ bool DecaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool DecDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Sub(Sizes::BYTE,
-                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                      il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool DecIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.Sub(
-      Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool DecIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Sub(
-      Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool DecSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Sub(
-      Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
 bool DecxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2050,137 +1174,43 @@ bool DecxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
 bool DivInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  // Shenanigans, bc I decided to make H:X one 16-bit register so indexing would
-  // be easy. So now this is hard.
-  il.AddInstruction(  // Get quotient and store in register A
+  // H:A is the dividend, with H the high byte of the 16-bit H:X register. It
+  // is kept in a temporary since A and H are both overwritten
+  il.AddInstruction(il.SetRegister(
+      Sizes::WORD, LLIL_TEMP(0),
+      il.Or(Sizes::WORD,
+            il.And(Sizes::WORD,
+                   il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
+                   il.Const(Sizes::WORD, 0xFF00)),
+            il.Register(Sizes::BYTE, Registers::HCS08_REG_A))));
+  // C is set when the quotient does not fit in A, i.e. H >= X (this includes
+  // division by zero); A and H are then indeterminate
+  il.AddInstruction(il.SetFlag(
+      Flags::FLAG_C,
+      il.CompareUnsignedGreaterEqual(
+          Sizes::WORD,
+          il.LogicalShiftRight(
+              Sizes::WORD, il.Register(Sizes::WORD, Registers::HCS08_REG_HX),
+              il.Const(Sizes::BYTE, 8)),
+          il.Register(Sizes::BYTE, Registers::HCS08_REG_X))));
+  il.AddInstruction(  // A = H:A / X
       il.SetRegister(
           Sizes::BYTE, Registers::HCS08_REG_A,
           il.DivDoublePrecUnsigned(
-              Sizes::WORD,
-              il.And(Sizes::WORD,  // H:A - dividend
-                     il.And(Sizes::WORD,
-                            il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                            il.Const(Sizes::WORD, 0xFF00)),
-                     il.Register(Sizes::BYTE, Registers::HCS08_REG_A)),
-              il.Register(Sizes::BYTE, Registers::HCS08_REG_X),  // X - divisor
-              Flags::FLAGS_C_Z)));
-  il.AddInstruction(  // Get remainder and store in register H
+              Sizes::BYTE, il.Register(Sizes::WORD, LLIL_TEMP(0)),
+              il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
+              Flags::FLAGS_Z)));
+  il.AddInstruction(  // H = H:A % X; X, the divisor, is unchanged
       il.SetRegister(
           Sizes::WORD, Registers::HCS08_REG_HX,
-          il.And(
-              Sizes::WORD,
-              il.ShiftLeft(
-                  Sizes::WORD,
-                  il.ModDoublePrecUnsigned(
-                      Sizes::WORD,
-                      il.And(Sizes::WORD,  // H:A - dividend
-                             il.And(Sizes::WORD,
-                                    il.Register(Sizes::BYTE,
-                                                Registers::HCS08_REG_X),
-                                    il.Const(Sizes::WORD, 0xFF00)),
-                             il.Register(Sizes::BYTE, Registers::HCS08_REG_A)),
-                      il.Register(Sizes::BYTE,
-                                  Registers::HCS08_REG_X)),  // X - divisor
-                  il.Const(Sizes::BYTE, 8)),  // new value of H - the remainder
-              il.Register(Sizes::BYTE,
-                          Registers::HCS08_REG_X))));  // divisor X, which
-                                                       // should be unchanged
-  return true;
-}
-
-bool EorDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Const(Sizes::BYTE, imm8), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX1_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX2_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP1_LOAD, Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool EorSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Xor(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP2_LOAD, Flags::FLAGS_Z_N_V)));
+          il.Or(Sizes::WORD,
+                il.ShiftLeft(
+                    Sizes::WORD,
+                    il.ModDoublePrecUnsigned(
+                        Sizes::BYTE, il.Register(Sizes::WORD, LLIL_TEMP(0)),
+                        il.Register(Sizes::BYTE, Registers::HCS08_REG_X)),
+                    il.Const(Sizes::BYTE, 8)),
+                il.Register(Sizes::BYTE, Registers::HCS08_REG_X))));
   return true;
 }
 
@@ -2195,45 +1225,6 @@ bool IncaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IncDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Add(Sizes::BYTE,
-                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                      il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool IncIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.Add(
-      Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool IncIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Add(
-      Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool IncSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Add(
-      Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
 bool IncxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2244,6 +1235,8 @@ bool IncxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
+uint8_t JmpDir::GetTarget(const uint8_t* opcode) { return opcode[1]; }
+
 bool JmpDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2252,6 +1245,10 @@ bool JmpDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
+uint16_t JmpExt::GetTarget(const uint8_t* opcode) {
+  return opcode[1] << 8 | opcode[2];
+}
+
 bool JmpExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2289,6 +1286,8 @@ bool JmpIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
+uint8_t JsrDir::GetTarget(const uint8_t* opcode) { return opcode[1]; }
+
 bool JsrDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2297,6 +1296,10 @@ bool JsrDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
+uint16_t JsrExt::GetTarget(const uint8_t* opcode) {
+  return opcode[1] << 8 | opcode[2];
+}
+
 bool JsrExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2328,121 +1331,9 @@ bool JsrIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   len = length;
   // Oprx16 is 16-bit offset from index register H:X
   int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.Call(il.Add(Sizes::WORD, il.Const(Sizes::WORD, oprx16),
-                     il.Register(Sizes::WORD, Registers::HCS08_REG_HX))));
-  return true;
-}
-
-bool LdaDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a))));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a))));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A,
-                                   il.Const(Sizes::BYTE, imm8)));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, IX_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, IX1_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, IX2_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, SP1_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdaSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, SP2_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
+  il.AddInstruction(
+      il.Call(il.Add(Sizes::WORD, il.Const(Sizes::WORD, oprx16),
+                     il.Register(Sizes::WORD, Registers::HCS08_REG_HX))));
   return true;
 }
 
@@ -2543,118 +1434,6 @@ bool LdhxSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LdxDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_X,
-      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a))));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_X,
-      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a))));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X,
-                                   il.Const(Sizes::BYTE, imm8)));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, IX_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, IX1_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, IX2_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, SP1_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
-bool LdxSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, SP2_LOAD));
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  return true;
-}
-
 bool LslaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2667,45 +1446,6 @@ bool LslaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LslDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(il.Store(
-      Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-      il.ShiftLeft(Sizes::BYTE,
-                   il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                   il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LslIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.ShiftLeft(
-      Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LslIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.ShiftLeft(
-      Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LslSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.ShiftLeft(
-      Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
 bool LslxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2729,46 +1469,6 @@ bool LsraInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LsrDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.LogicalShiftRight(
-                   Sizes::BYTE,
-                   il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                   il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LsrIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.LogicalShiftRight(
-      Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LsrIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.LogicalShiftRight(
-      Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool LsrSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.LogicalShiftRight(
-      Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
 bool LsrxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -2838,197 +1538,62 @@ bool MulInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
   // TODO? flags - FLAG_C and FLAG_H both get set to 0
-  BN::ExprId result = il.MultDoublePrecUnsigned(
-      Sizes::WORD, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-      il.Register(Sizes::BYTE, Registers::HCS08_REG_A));
-  il.AddInstruction(  // Set X = high byte of result
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X,
-                     il.And(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
-                            il.LogicalShiftRight(Sizes::WORD, result,
-                                                 il.Const(Sizes::BYTE, 8)))));
-  il.AddInstruction(  // Set A = low byte of result
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A,
-                     il.And(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF), result)));
-  return true;
-}
-
-bool NegaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE,             // Size of register
-                     Registers::HCS08_REG_A,  // Register to set
-                     il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                            il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                            Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NegDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                      il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                      Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NegIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                                    IX_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NegIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                                     IX1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NegSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                                     SP1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NegxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X,
-                     il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
-                            il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                            Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool NopInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Nop());
-  return true;
-}
-
-bool NsaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE,
-            il.ShiftLeft(Sizes::BYTE,
-                         il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                         il.Const(Sizes::BYTE, 4)),
-            il.LogicalShiftRight(
-                Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                il.Const(Sizes::BYTE, 4)))));
-  return true;
-}
-
-bool OraDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-            Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool OraExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-            Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool OraImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            il.Const(Sizes::BYTE, imm8), Flags::FLAGS_Z_N_V)));
-  return true;
-}
-
-bool OraIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            IX_LOAD, Flags::FLAGS_Z_N_V)));
+  BN::ExprId result = il.MultDoublePrecUnsigned(
+      Sizes::WORD, il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
+      il.Register(Sizes::BYTE, Registers::HCS08_REG_A));
+  il.AddInstruction(  // Set X = high byte of result
+      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X,
+                     il.And(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF),
+                            il.LogicalShiftRight(Sizes::WORD, result,
+                                                 il.Const(Sizes::BYTE, 8)))));
+  il.AddInstruction(  // Set A = low byte of result
+      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A,
+                     il.And(Sizes::BYTE, il.Const(Sizes::BYTE, 0xFF), result)));
   return true;
 }
 
-bool OraIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
+bool NegaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            IX1_LOAD, Flags::FLAGS_Z_N_V)));
+  il.AddInstruction(
+      il.SetRegister(Sizes::BYTE,             // Size of register
+                     Registers::HCS08_REG_A,  // Register to set
+                     il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
+                            il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
+                            Flags::FLAGS_C_Z_N_V)));
   return true;
 }
 
-bool OraIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
+bool NegxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            IX2_LOAD, Flags::FLAGS_Z_N_V)));
+  il.AddInstruction(
+      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X,
+                     il.Sub(Sizes::BYTE, il.Const(Sizes::BYTE, 0),
+                            il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
+                            Flags::FLAGS_C_Z_N_V)));
   return true;
 }
 
-bool OraSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool NopInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            SP1_LOAD, Flags::FLAGS_Z_N_V)));
+  il.AddInstruction(il.Nop());
   return true;
 }
 
-bool OraSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool NsaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
   il.AddInstruction(il.SetRegister(
       Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Or(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-            SP2_LOAD, Flags::FLAGS_Z_N_V)));
+      il.Or(Sizes::BYTE,
+            il.ShiftLeft(Sizes::BYTE,
+                         il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
+                         il.Const(Sizes::BYTE, 4)),
+            il.LogicalShiftRight(
+                Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
+                il.Const(Sizes::BYTE, 4)))));
   return true;
 }
 
@@ -3147,57 +1712,6 @@ bool RolaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RolDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(il.Store(
-      Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-      il.Or(Sizes::BYTE,
-            il.ShiftLeft(
-                Sizes::BYTE,
-                il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                il.Const(Sizes::BYTE, 7), Flags::FLAGS_C_Z_N_V),
-            il.Flag(Flags::FLAG_C))));
-  return true;
-}
-
-bool RolIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(
-      il.Or(Sizes::BYTE,
-            il.ShiftLeft(Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 7),
-                         Flags::FLAGS_C_Z_N_V),
-            il.Flag(Flags::FLAG_C))));
-  return true;
-}
-
-bool RolIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(
-      il.Or(Sizes::BYTE,
-            il.ShiftLeft(Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 7),
-                         Flags::FLAGS_C_Z_N_V),
-            il.Flag(Flags::FLAG_C))));
-  return true;
-}
-
-bool RolSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(
-      il.Or(Sizes::BYTE,
-            il.ShiftLeft(Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 7),
-                         Flags::FLAGS_C_Z_N_V),
-            il.Flag(Flags::FLAG_C))));
-  return true;
-}
-
 bool RolxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -3226,34 +1740,6 @@ bool RoraInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RorDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(il.Store(
-      Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-      il.Or(Sizes::BYTE,
-            il.LogicalShiftRight(
-                Sizes::BYTE,
-                il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                il.Const(Sizes::BYTE, 1), Flags::FLAGS_C_Z_N_V),
-            il.ShiftLeft(Sizes::BYTE, il.Flag(Flags::FLAG_C),
-                         il.Const(Sizes::BYTE, 7)))));
-  return true;
-}
-
-bool RorIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(IX_STORE(
-      il.Or(Sizes::BYTE,
-            il.LogicalShiftRight(Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 1),
-                                 Flags::FLAGS_C_Z_N_V),
-            il.ShiftLeft(Sizes::BYTE, il.Flag(Flags::FLAG_C),
-                         il.Const(Sizes::BYTE, 7)))));
-  return true;
-}
-
 bool RorxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -3268,284 +1754,54 @@ bool RorxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RorIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(IX1_STORE(il.Or(
-      Sizes::BYTE,
-      il.LogicalShiftRight(Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 1),
-                           Flags::FLAGS_C_Z_N_V),
-      il.ShiftLeft(Sizes::BYTE, il.Flag(Flags::FLAG_C),
-                   il.Const(Sizes::BYTE, 7)))));
-  return true;
-}
-
-bool RorSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(SP1_STORE(il.Or(
-      Sizes::BYTE,
-      il.LogicalShiftRight(Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 1),
-                           Flags::FLAGS_C_Z_N_V),
-      il.ShiftLeft(Sizes::BYTE, il.Flag(Flags::FLAG_C),
-                   il.Const(Sizes::BYTE, 7)))));
-  return true;
-}
-
 bool RspInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
   il.AddInstruction(il.SetRegister(
       Sizes::WORD,
       Registers::HCS08_REG_SP,  // Instruction only sets LSB of SP, that's why
-                                // it's being addressed as a Sizes::BYTE not a
-                                // Sizes::WORD. MSB should be unaffected
-      il.Or(Sizes::WORD, il.Register(Sizes::BYTE, Registers::HCS08_REG_SP),
-            il.Const(Sizes::BYTE, 0xFF))));
-  return true;
-}
-
-bool RtiInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Restore CCR, A, and X from stack
-  il.AddInstruction(il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_CCR,
-                                   il.Pop(Sizes::BYTE)));
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, il.Pop(Sizes::BYTE)));
-  il.AddInstruction(
-      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, il.Pop(Sizes::BYTE)));
-  // PC is also restored from stack
-  il.AddInstruction(il.Jump(il.Pop(Sizes::WORD)));
-  return true;
-}
-
-bool RtsInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // PC is restored from stack
-  il.AddInstruction(il.Return(il.Pop(Sizes::WORD)));
-  return true;
-}
-
-bool SbcDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                   il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                   il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(
-          Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-          il.Const(Sizes::BYTE, imm8), Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A), IX_LOAD,
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A), IX1_LOAD,
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A), IX2_LOAD,
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A), SP1_LOAD,
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SbcSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.SubBorrow(Sizes::BYTE,
-                   il.Register(Sizes::BYTE, Registers::HCS08_REG_A), SP2_LOAD,
-                   Flags::FLAG_C, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SecInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetFlag(Flags::FLAG_C, il.Const(Sizes::BYTE, 1)));
-
-  return true;
-}
-
-bool SeiInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetFlag(Flags::FLAG_I, il.Const(Sizes::BYTE, 1)));
-  return true;
-}
-
-bool StaDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
-  return true;
-}
-
-bool StaExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a),
-               il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
-  return true;
-}
-
-bool StaIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      IX_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
+                                // it's being addressed as a Sizes::BYTE not a
+                                // Sizes::WORD. MSB should be unaffected
+      il.Or(Sizes::WORD, il.Register(Sizes::BYTE, Registers::HCS08_REG_SP),
+            il.Const(Sizes::BYTE, 0xFF))));
   return true;
 }
 
-bool StaIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool RtiInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
+  // Restore CCR, A, and X from stack
+  il.AddInstruction(il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_CCR,
+                                   il.Pop(Sizes::BYTE)));
+  il.AddInstruction(
+      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_A, il.Pop(Sizes::BYTE)));
   il.AddInstruction(
-      IX1_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
+      il.SetRegister(Sizes::BYTE, Registers::HCS08_REG_X, il.Pop(Sizes::BYTE)));
+  // PC is also restored from stack
+  il.AddInstruction(il.Jump(il.Pop(Sizes::WORD)));
   return true;
 }
 
-bool StaIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool RtsInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      IX2_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
+  // PC is restored from stack
+  il.AddInstruction(il.Return(il.Pop(Sizes::WORD)));
   return true;
 }
 
-bool StaSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool SecInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      SP1_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
+  il.AddInstruction(il.SetFlag(Flags::FLAG_C, il.Const(Sizes::BYTE, 1)));
+
   return true;
 }
 
-bool StaSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
+bool SeiInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      SP2_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_A)));  // Store A
+  il.AddInstruction(il.SetFlag(Flags::FLAG_I, il.Const(Sizes::BYTE, 1)));
   return true;
 }
 
@@ -3598,201 +1854,6 @@ bool StopInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   UNIMPLEMENTED
 }
 
-bool StxDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a),
-               il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      il.Store(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a),
-               il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      IX_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      IX1_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      IX2_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      SP1_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool StxSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE,
-                           il.Register(Sizes::BYTE, Registers::HCS08_REG_X),
-                           il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));  // Set flags
-  il.AddInstruction(
-      SP2_STORE(il.Register(Sizes::BYTE, Registers::HCS08_REG_X)));  // Store X
-  return true;
-}
-
-bool SubDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr8a/opcode[1] is low byte of address in direct address space $0000-$00FF
-  uint8_t opr8a = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-             Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubExt::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Opr16a is address anywhere in the 16-bit address space
-  uint16_t opr16a = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr16a)),
-             Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubImm::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int8_t imm8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             il.Const(Sizes::BYTE, imm8), Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx8 is 8-bit offset from index register H:X
-  int16_t oprx8 = opcode[1];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubIx2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  // Oprx16 is 16-bit offset from index register H:X
-  int16_t oprx16 = opcode[1] << 8 | opcode[2];
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             IX2_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx16 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP1_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
-bool SubSp2::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx16 =
-      opcode[2] << 8 |
-      opcode[3];  // oprx16 operand is 16-bit offset from stack pointer
-  il.AddInstruction(il.SetRegister(
-      Sizes::BYTE, Registers::HCS08_REG_A,
-      il.Sub(Sizes::BYTE, il.Register(Sizes::BYTE, Registers::HCS08_REG_A),
-             SP2_LOAD, Flags::FLAGS_C_Z_N_V)));
-  return true;
-}
-
 bool SwiInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                   BN::LowLevelILFunction& il, BN::Architecture* arch) {
   UNIMPLEMENTED
@@ -3883,43 +1944,6 @@ bool TstaInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TstDir::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  uint8_t opr8a = opcode[1];  // opr8a is low byte of address in direct address
-  il.AddInstruction(il.Sub(
-      Sizes::BYTE, il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-      il.Const(Sizes::BYTE, 0), Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool TstIx::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                 BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  il.AddInstruction(il.Sub(Sizes::BYTE, IX_LOAD, il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool TstIx1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 = opcode[1];  // oprx8 is 8-bit offset from index register H:X
-  il.AddInstruction(il.Sub(Sizes::BYTE, IX1_LOAD, il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));
-  return true;
-}
-
-bool TstSp1::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
-                  BN::LowLevelILFunction& il, BN::Architecture* arch) {
-  len = length;
-  int16_t oprx8 =
-      opcode[2];  // oprx8 operand is 8-bit offset from stack pointer
-  il.AddInstruction(il.Sub(Sizes::BYTE, SP1_LOAD, il.Const(Sizes::BYTE, 0),
-                           Flags::FLAGS_Z_N_V));
-  return true;
-}
-
 bool TstxInh::Lift(const uint8_t* opcode, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BN::Architecture* arch) {
   len = length;
@@ -3973,35 +1997,17 @@ bool LiftBranchRel(const uint8_t* data, uint64_t addr, size_t& len,
                    BinaryNinja::Architecture* arch) {
   uint8_t opcode = data[0];
   int8_t relOffset = data[1];  // rel operand is used to calculate branch target
-
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget =
-      falseBranchTarget + static_cast<int8_t>(relOffset);
-
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
+  const uint16_t target = RelativeTarget(addr, len, relOffset);
+  BranchEmitter branch(il, arch);
 
   /* Determine branch instruction based on the condition code */
   BN::ExprId conditionIL;
   switch (opcode) {
     case Opcodes::BCC_BHS_REL:  // Carry bit clear/higher or same
-      conditionIL = il.FlagCondition(LLFC_ULT);
+      conditionIL = il.FlagCondition(LLFC_UGE);
       break;
     case Opcodes::BCS_BLO_REL:  // Carry bit set/lower
-      conditionIL = il.FlagCondition(LLFC_UGE);
+      conditionIL = il.FlagCondition(LLFC_ULT);
       break;
     case Opcodes::BEQ_REL:  // Equal
       conditionIL = il.FlagCondition(LLFC_E);
@@ -4034,7 +2040,7 @@ bool LiftBranchRel(const uint8_t* data, uint64_t addr, size_t& len,
       conditionIL = il.FlagCondition(LLFC_POS);
       break;
     case Opcodes::BRA_REL:  // Always; unconditional branch
-      il.AddInstruction(il.Jump(dest_if_true));
+      branch.Jump(target);
       return true;
     case Opcodes::BRN_REL:          // Branch never
       il.AddInstruction(il.Nop());  // Do nothing
@@ -4050,28 +2056,7 @@ bool LiftBranchRel(const uint8_t* data, uint64_t addr, size_t& len,
       return true;
   }
 
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-
-  il.AddInstruction(il.If(conditionIL, true_label, false_label));
-
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
-  }
-
+  branch.If(conditionIL, target, addr + len);
   return true;
 }
 
@@ -4121,72 +2106,24 @@ bool LiftBrsetBrclrDir(const uint8_t* data, uint64_t addr, size_t& len,
                                 // 0x0000-0x00FF) of byte to operate on
   int8_t relOffset = data[2];   // Offset used to calculate branch target
 
-  // Sign-extend relative offset to 16-bit int
-  int16_t signExtOffset;
-  if (relOffset >> 7) {  // Negative
-    signExtOffset = 0xFF00 | relOffset;
-  } else {  // Positive
-    signExtOffset = relOffset;
-  }
-
   // Test bit in memory
-  il.SetFlag(
+  il.AddInstruction(il.SetFlag(
       Flags::FLAG_C,
       il.TestBit(Sizes::BYTE,
                  il.Load(Sizes::BYTE, il.ConstPointer(Sizes::WORD, opr8a)),
-                 il.Const(Sizes::BYTE, bit_n)));
+                 il.Const(Sizes::BYTE, bit_n))));
 
   // Determine which instruction based on least-significant bit
   BN::ExprId conditionIL;
   if (opcode & 1) {  // BRCLR - Branch if bit N in memory is clear
-    conditionIL = il.FlagCondition(LLFC_ULT);  // Carry bit clear
+    conditionIL = il.FlagCondition(LLFC_UGE);  // Carry bit clear
 
   } else {  // BRSET - Branch if bit N in memory is set
-    conditionIL = il.FlagCondition(LLFC_UGE);  // Carry bit set
-  }
-
-  // Calculate branch targets
-  uint16_t falseBranchTarget = addr + len;
-  uint16_t trueBranchTarget = falseBranchTarget + signExtOffset;
-
-  /* Get label for true branch, if one exists */
-  BN::ExprId dest_if_true = il.Const(Sizes::WORD, trueBranchTarget);
-  BNLowLevelILLabel *t, *f;
-  t = il.GetLabelForAddress(arch, dest_if_true);
-
-  bool indirect;
-  BNLowLevelILLabel true_label, false_label;
-  if (t) {
-    indirect = false;
-    true_label = *t;
-
-  } else {
-    indirect = true;
-    true_label = BN::LowLevelILLabel();
-  }
-
-  BN::ExprId dest_if_false = il.Const(Sizes::WORD, falseBranchTarget);
-  f = il.GetLabelForAddress(arch, dest_if_false);
-  bool found_false_label;
-  if (f) {
-    found_false_label = true;
-    false_label = *f;
-  } else {
-    found_false_label = false;
-    false_label = BN::LowLevelILLabel();
-  }
-
-  il.AddInstruction(il.If(conditionIL, true_label, false_label));
-
-  if (indirect) {
-    il.MarkLabel(true_label);
-    il.AddInstruction(il.Jump(dest_if_true));
-  }
-
-  if (!found_false_label) {
-    il.MarkLabel(false_label);
+    conditionIL = il.FlagCondition(LLFC_ULT);  // Carry bit set
   }
 
+  BranchEmitter(il, arch)
+      .If(conditionIL, RelativeTarget(addr, len, relOffset), addr + len);
   return true;
 }
 
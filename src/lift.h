@@ -11,6 +11,27 @@
 namespace BN = BinaryNinja;
 
 namespace HCS08 {
+/*
+ * Emits branches to constant targets. A target with an existing label is
+ * reached with If/Goto on that label; any other target gets a local label and
+ * an explicit jump, and a missing fall-through label is marked in place.
+ * The target constant is only built when a jump is emitted.
+ */
+class BranchEmitter {
+ public:
+  BranchEmitter(BN::LowLevelILFunction& il, BN::Architecture* arch);
+  void Jump(uint64_t target);
+  void If(BN::ExprId condition, uint64_t target, uint64_t fallthrough);
+
+ private:
+  BN::LowLevelILFunction& IL;
+  BN::Architecture* ARCH;
+};
+
+// Target of a relative branch: the rel operand is a signed offset from the
+// address of the next instruction
+uint16_t RelativeTarget(uint64_t addr, size_t len, int8_t relOffset);
+
 bool LiftBranchRel(const uint8_t* data, uint64_t addr, size_t& len,
                    BN::LowLevelILFunction& il, BinaryNinja::Architecture* arch);
 bool LiftBsetBclrDir(const uint8_t* data, size_t& len,
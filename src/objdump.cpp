@@ -0,0 +1,243 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "descriptors.h"
+#include "render.h"
+#include "sizes.h"
+#include "srecord.h"
+
+namespace {
+constexpr const char* USAGE =
+    "usage: hcs08-objdump [--base ADDR] [--format bin|srec|ihex] FILE\n"
+    "  --base ADDR             load address of a flat binary (default 0)\n"
+    "  --format bin|srec|ihex  input format (default: detected from "
+    "contents)\n";
+
+/*
+ * Output is assembled in a fixed buffer and handed to fwrite in large blocks,
+ * so a line costs a few memcpy calls and no std::string.
+ */
+class OutputBuffer {
+ public:
+  explicit OutputBuffer(FILE* out) : OUT(out) {}
+  OutputBuffer(const OutputBuffer&) = delete;
+  OutputBuffer& operator=(const OutputBuffer&) = delete;
+  ~OutputBuffer() { Flush(); }
+
+  // Longest line: address, four bytes, mnemonic and six operand tokens
+  static constexpr size_t MAX_LINE = 128;
+
+  void Reserve() {
+    if (USED + MAX_LINE > BUFFER.size()) {
+      Flush();
+    }
+  }
+
+  void Put(const char c) { BUFFER[USED++] = c; }
+
+  void Write(const std::string_view text) {
+    std::memcpy(BUFFER.data() + USED, text.data(), text.size());
+    USED += text.size();
+  }
+
+  // Fixed-width lowercase hex
+  void Hex(const uint64_t value, int digits) {
+    static constexpr char DIGITS[] = "0123456789abcdef";
+    while (digits-- > 0) {
+      Put(DIGITS[value >> (digits * 4) & 0xF]);
+    }
+  }
+
+  void Pad(const size_t column, const size_t lineStart) {
+    while (USED - lineStart < column) {
+      Put(' ');
+    }
+  }
+
+  size_t Position() const { return USED; }
+
+  bool Flush() {
+    const bool ok = fwrite(BUFFER.data(), 1, USED, OUT) == USED;
+    USED = 0;
+    return ok;
+  }
+
+ private:
+  FILE* OUT;
+  std::array<char, 1 << 16> BUFFER;
+  size_t USED = 0;
+};
+
+// Columns of the bytes and text fields, as in objdump
+constexpr size_t BYTES_COLUMN = 10;
+constexpr size_t TEXT_COLUMN = 24;
+
+// Address digits: four for the 64 KiB space, more for banked or S2/S3 images
+int AddressDigits(const std::vector<HCS08::MemorySegment>& segments) {
+  uint64_t end = 0;
+  for (const HCS08::MemorySegment& segment : segments) {
+    end = std::max<uint64_t>(end, segment.address + segment.data.size());
+  }
+  int digits = 4;
+  while (digits < 8 && end > (uint64_t{1} << (digits * 4))) {
+    digits += 2;
+  }
+  return digits;
+}
+
+void DisassembleSegment(const HCS08::MemorySegment& segment,
+                        const int addressDigits, OutputBuffer& out) {
+  const uint8_t* data = segment.data.data();
+  const size_t size = segment.data.size();
+  HCS08::RenderedInstruction rendered;
+  size_t offset = 0;
+  while (offset < size) {
+    const uint64_t addr = uint64_t{segment.address} + offset;
+    size_t needed;
+    const HCS08::InstructionDescriptor* descriptor =
+        HCS08::DecodeDescriptor(data + offset, size - offset, needed);
+    // Undefined opcodes and a truncated tail are printed a byte at a time
+    const size_t length =
+        descriptor ? descriptor->length : HCS08::Sizes::INSTRUCTION_1_BYTE;
+
+    out.Reserve();
+    const size_t lineStart = out.Position();
+    out.Write("  ");
+    out.Hex(addr, addressDigits);
+    out.Write(": ");
+    out.Pad(BYTES_COLUMN, lineStart);
+    for (size_t i = 0; i < length; i++) {
+      out.Hex(data[offset + i], 2);
+      out.Put(' ');
+    }
+    out.Pad(TEXT_COLUMN, lineStart);
+
+    if (descriptor == nullptr) {
+      out.Write(".byte $");
+      out.Hex(data[offset], 2);
+    } else {
+      HCS08::RenderInstruction(*descriptor, data + offset, rendered);
+      for (uint8_t i = 0; i < rendered.count; i++) {
+        out.Write(rendered.tokens[i].Text());
+      }
+      // Resolve relative branches, whose operand is only an offset
+      uint16_t target;
+      if (descriptor->mode != HCS08::AddressingMode::DIR &&
+          descriptor->mode != HCS08::AddressingMode::EXT &&
+          HCS08::GetBranchTarget(*descriptor, data + offset, addr, target)) {
+        out.Write("  ; $");
+        out.Hex(target, 4);
+      }
+    }
+    out.Put('\n');
+    offset += length;
+  }
+}
+
+bool ReadFile(const char* path, std::string& contents) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  contents.assign(std::istreambuf_iterator<char>(in),
+                  std::istreambuf_iterator<char>());
+  return !in.bad();
+}
+
+int Fail(const std::string& message) {
+  std::cerr << "hcs08-objdump: " << message << "\n" << USAGE;
+  return 1;
+}
+}  // namespace
+
+/*
+ * Disassembles a raw binary or S-record file to stdout without Binary Ninja,
+ * using the same descriptor table and token templates as the plugin.
+ */
+int main(const int argc, char** argv) {
+  uint64_t base = 0;
+  std::string format;
+  const char* path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if ((arg == "--base" || arg == "--format") && i + 1 >= argc) {
+      return Fail("missing value for " + std::string(arg));
+    }
+    if (arg == "--base") {
+      std::string_view value = argv[++i];
+      int radix = 10;
+      if (value.starts_with("0x") || value.starts_with("0X")) {
+        value.remove_prefix(2);
+        radix = 16;
+      }
+      const auto [ptr, error] = std::from_chars(
+          value.data(), value.data() + value.size(), base, radix);
+      if (error != std::errc() || ptr != value.data() + value.size() ||
+          base > UINT32_MAX) {
+        return Fail("invalid base " + std::string(argv[i]));
+      }
+    } else if (arg == "--format") {
+      format = argv[++i];
+      if (format != "bin" && format != "srec" && format != "ihex") {
+        return Fail("unknown format " + format);
+      }
+    } else if (arg.starts_with("--") || path != nullptr) {
+      return Fail("unexpected argument " + std::string(arg));
+    } else {
+      path = argv[i];
+    }
+  }
+  if (path == nullptr) {
+    return Fail("no input file");
+  }
+
+  std::string contents;
+  if (!ReadFile(path, contents)) {
+    return Fail("cannot read " + std::string(path));
+  }
+  if (format.empty()) {
+    format = HCS08::LooksLikeSRecords(contents)   ? "srec"
+             : HCS08::LooksLikeIntelHex(contents) ? "ihex"
+                                                  : "bin";
+  }
+
+  std::vector<HCS08::MemorySegment> segments;
+  if (format == "srec") {
+    if (!HCS08::ParseSRecords(contents, segments)) {
+      return Fail("malformed S-record file " + std::string(path));
+    }
+  } else if (format == "ihex") {
+    if (!HCS08::ParseIntelHex(contents, segments)) {
+      return Fail("malformed Intel HEX file " + std::string(path));
+    }
+  } else {
+    segments.push_back({static_cast<uint32_t>(base),
+                        std::vector<uint8_t>(contents.begin(),
+                                             contents.end())});
+  }
+
+  OutputBuffer out(stdout);
+  const int addressDigits = AddressDigits(segments);
+  for (const HCS08::MemorySegment& segment : segments) {
+    DisassembleSegment(segment, addressDigits, out);
+  }
+  if (!out.Flush()) {
+    std::cerr << "hcs08-objdump: write error\n";
+    return 1;
+  }
+  return 0;
+}
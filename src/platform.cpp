@@ -0,0 +1,102 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "platform.h"
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "registers.h"
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+namespace {
+// Everything a call may change; SP and PC are restored by RTS
+std::vector<uint32_t> ScratchRegisters() {
+  return {Registers::HCS08_REG_A, Registers::HCS08_REG_HX,
+          Registers::HCS08_REG_CCR};
+}
+}  // namespace
+
+RegisterCallingConvention::RegisterCallingConvention(BN::Architecture* arch)
+    : CallingConvention(arch, "register") {}
+
+std::vector<uint32_t> RegisterCallingConvention::GetCallerSavedRegisters() {
+  return ScratchRegisters();
+}
+
+std::vector<uint32_t>
+RegisterCallingConvention::GetIntegerArgumentRegisters() {
+  return {Registers::HCS08_REG_A, Registers::HCS08_REG_HX};
+}
+
+uint32_t RegisterCallingConvention::GetIntegerReturnValueRegister() {
+  return Registers::HCS08_REG_A;
+}
+
+uint32_t RegisterCallingConvention::GetHighIntegerReturnValueRegister() {
+  return Registers::HCS08_REG_X;
+}
+
+StackCallingConvention::StackCallingConvention(BN::Architecture* arch)
+    : CallingConvention(arch, "stack") {}
+
+std::vector<uint32_t> StackCallingConvention::GetCallerSavedRegisters() {
+  return ScratchRegisters();
+}
+
+uint32_t StackCallingConvention::GetIntegerReturnValueRegister() {
+  return Registers::HCS08_REG_A;
+}
+
+uint32_t StackCallingConvention::GetHighIntegerReturnValueRegister() {
+  return Registers::HCS08_REG_X;
+}
+
+InterruptCallingConvention::InterruptCallingConvention(BN::Architecture* arch)
+    : CallingConvention(arch, NAME) {}
+
+std::vector<uint32_t> InterruptCallingConvention::GetCalleeSavedRegisters() {
+  return ScratchRegisters();
+}
+
+// Only vector table entries should get this convention, never a guess
+bool InterruptCallingConvention::IsEligibleForHeuristics() { return false; }
+
+uint32_t InterruptCallingConvention::GetIntegerReturnValueRegister() {
+  return BN_INVALID_REGISTER;
+}
+
+/**
+ * RegisterPlatform - Register the calling conventions with the architecture,
+ * making the register convention the default, and the hcs08 platform that
+ * uses them
+ * @param arch - the registered hcs08 architecture
+ */
+void RegisterPlatform(BN::Architecture* arch) {
+  BN::Ref<BN::CallingConvention> registers =
+      new RegisterCallingConvention(arch);
+  BN::Ref<BN::CallingConvention> stack = new StackCallingConvention(arch);
+  BN::Ref<BN::CallingConvention> interrupt =
+      new InterruptCallingConvention(arch);
+
+  arch->RegisterCallingConvention(registers);
+  arch->RegisterCallingConvention(stack);
+  arch->RegisterCallingConvention(interrupt);
+  arch->SetDefaultCallingConvention(registers);
+  arch->SetFastcallCallingConvention(registers);
+  arch->SetCdeclCallingConvention(stack);
+
+  BN::Ref<BN::Platform> platform = new BN::Platform(arch, "hcs08");
+  platform->RegisterCallingConvention(registers);
+  platform->RegisterCallingConvention(stack);
+  platform->RegisterCallingConvention(interrupt);
+  platform->RegisterDefaultCallingConvention(registers);
+  platform->RegisterFastcallCallingConvention(registers);
+  platform->RegisterCdeclCallingConvention(stack);
+  BN::Platform::Register("hcs08", platform);
+}
+}  // namespace HCS08
@@ -0,0 +1,62 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_PLATFORM_H
+#define HCS08_PLATFORM_H
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+/*
+ * CodeWarrior's HC(S)08 register convention: an 8-bit argument in A and a
+ * 16-bit argument in H:X, the rest on the stack, and 16-bit results in X:A.
+ * Every register except SP is scratch.
+ */
+class RegisterCallingConvention : public BN::CallingConvention {
+ public:
+  explicit RegisterCallingConvention(BN::Architecture* arch);
+
+  std::vector<uint32_t> GetCallerSavedRegisters() override;
+  std::vector<uint32_t> GetIntegerArgumentRegisters() override;
+  uint32_t GetIntegerReturnValueRegister() override;
+  uint32_t GetHighIntegerReturnValueRegister() override;
+};
+
+/*
+ * All arguments on the stack, popped by the caller; results as in the
+ * register convention. Common in hand-written assembly.
+ */
+class StackCallingConvention : public BN::CallingConvention {
+ public:
+  explicit StackCallingConvention(BN::Architecture* arch);
+
+  std::vector<uint32_t> GetCallerSavedRegisters() override;
+  uint32_t GetIntegerReturnValueRegister() override;
+  uint32_t GetHighIntegerReturnValueRegister() override;
+};
+
+/*
+ * Interrupt handlers take nothing, return nothing and must leave every
+ * register as they found it: the CPU stacks CCR, A, X and PC, and handlers
+ * push H themselves.
+ */
+class InterruptCallingConvention : public BN::CallingConvention {
+ public:
+  static constexpr const char* NAME = "interrupt";
+
+  explicit InterruptCallingConvention(BN::Architecture* arch);
+
+  std::vector<uint32_t> GetCalleeSavedRegisters() override;
+  bool IsEligibleForHeuristics() override;
+  uint32_t GetIntegerReturnValueRegister() override;
+};
+
+void RegisterPlatform(BN::Architecture* arch);
+}  // namespace HCS08
+
+#endif  // HCS08_PLATFORM_H
@@ -0,0 +1,264 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "render.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include "descriptors.h"
+#include "registers.h"
+
+namespace HCS08 {
+namespace {
+/*
+ * Every rendering is a fixed shape per addressing mode: the mnemonic, a space
+ * and a list of token slots. A slot is either static text (separators,
+ * registers, the post-increment marker) or an operand field read from a fixed
+ * offset past the opcode. Rendering copies the template and patches in the
+ * operand values, so every opcode takes the same path.
+ */
+enum class Field : uint8_t {
+  SEPARATOR,   // ","
+  REG_X,       // "X"
+  REG_SP,      // "SP"
+  POSTINC,     // "+"
+  BIT,         // bit number encoded in the opcode, BSET/BCLR/BRSET/BRCLR
+  HEX8,        // 8-bit value
+  IMM8,        // 8-bit immediate
+  HEX16,       // 16-bit value
+  IMM16,       // 16-bit immediate
+  REL8,        // rel, printed as the raw byte
+  REL16,       // rel, sign-extended to 16 bits
+  BSR_TARGET,  // rel, sign-extended and relative to the next instruction
+};
+
+struct TokenSlot {
+  TokenKind kind;
+  Field field;
+  uint8_t offset;  // operand byte, counted from the last opcode byte
+};
+
+constexpr size_t MAX_SLOTS = RenderedInstruction::MAX_TOKENS - 2;
+
+struct TextTemplate {
+  uint8_t count;
+  std::array<TokenSlot, MAX_SLOTS> slots;
+};
+
+constexpr TokenSlot SEP{TokenKind::SEPARATOR, Field::SEPARATOR, 0};
+constexpr TokenSlot X{TokenKind::REGISTER, Field::REG_X, 0};
+constexpr TokenSlot SP{TokenKind::REGISTER, Field::REG_SP, 0};
+constexpr TokenSlot PLUS{TokenKind::TEXT, Field::POSTINC, 0};
+constexpr TokenSlot BIT{TokenKind::INTEGER, Field::BIT, 0};
+
+constexpr TokenSlot Int8(const uint8_t offset) {
+  return {TokenKind::INTEGER, Field::HEX8, offset};
+}
+
+constexpr TokenSlot Addr8(const uint8_t offset) {
+  return {TokenKind::ADDRESS, Field::HEX8, offset};
+}
+
+constexpr TokenSlot Imm8At(const uint8_t offset) {
+  return {TokenKind::INTEGER, Field::IMM8, offset};
+}
+
+constexpr TokenSlot Rel8(const uint8_t offset) {
+  return {TokenKind::INTEGER, Field::REL8, offset};
+}
+
+constexpr TextTemplate Template(std::initializer_list<TokenSlot> slots) {
+  TextTemplate result{};
+  for (const TokenSlot& slot : slots) {
+    result.slots[result.count++] = slot;
+  }
+  return result;
+}
+
+constexpr size_t MODE_COUNT =
+    static_cast<size_t>(AddressingMode::IX_POSTINC_DIR) + 1;
+
+constexpr auto TEMPLATES = [] {
+  using enum AddressingMode;
+  using enum TokenKind;
+  std::array<TextTemplate, MODE_COUNT> table{};
+  auto set = [&table](AddressingMode mode, TextTemplate tmpl) {
+    table[static_cast<size_t>(mode)] = tmpl;
+  };
+  set(INH, Template({}));
+  set(IMM, Template({Imm8At(1)}));
+  set(IMM16, Template({{INTEGER, Field::IMM16, 1}}));
+  set(DIR, Template({Addr8(1)}));
+  set(EXT, Template({{ADDRESS, Field::HEX16, 1}}));
+  set(IX, Template({SEP, X}));
+  set(IX1, Template({Int8(1), SEP, X}));
+  set(IX2, Template({{INTEGER, Field::HEX16, 1}, SEP, X}));
+  set(SP1, Template({Int8(1), SEP, SP}));
+  set(SP2, Template({{INTEGER, Field::HEX16, 1}, SEP, SP}));
+  set(REL, Template({Rel8(1)}));
+  set(BIT_DIR, Template({BIT, SEP, Int8(1)}));
+  set(BIT_DIR_REL,
+      Template({BIT, SEP, Addr8(1), SEP, {INTEGER, Field::REL16, 2}}));
+  set(IMM_REL, Template({Imm8At(1), SEP, Rel8(2)}));
+  set(DIR_REL, Template({Addr8(1), SEP, Rel8(2)}));
+  set(INH_REL, Template({Rel8(1)}));
+  set(IX_REL, Template({SEP, X, SEP, Rel8(1)}));
+  set(IX1_REL, Template({Int8(1), SEP, X, SEP, Rel8(2)}));
+  set(IX_POSTINC_REL, Template({SEP, X, PLUS, SEP, Rel8(1)}));
+  set(IX1_POSTINC_REL, Template({Int8(1), SEP, X, PLUS, SEP, Rel8(2)}));
+  set(SP1_REL, Template({Int8(1), SEP, SP, SEP, Rel8(2)}));
+  set(DIR_DIR, Template({Int8(1), SEP, Int8(2)}));
+  set(DIR_IX_POSTINC, Template({Int8(1), SEP, X, PLUS}));
+  set(IMM_DIR, Template({Imm8At(1), SEP, Int8(2)}));
+  set(IX_POSTINC_DIR, Template({SEP, X, PLUS, SEP, Int8(1)}));
+  return table;
+}();
+
+// BSR shares the REL encoding but prints the offset from the next instruction
+constexpr TextTemplate BSR_TEMPLATE =
+    Template({{TokenKind::INTEGER, Field::BSR_TARGET, 1}});
+
+const TextTemplate& GetTemplate(const InstructionDescriptor& descriptor) {
+  if (descriptor.mnemonic == Mnemonic::BSR) {
+    return BSR_TEMPLATE;
+  }
+  return TEMPLATES[static_cast<size_t>(descriptor.mode)];
+}
+
+int16_t SignExtend(const uint8_t value) { return static_cast<int8_t>(value); }
+
+RenderedToken& NextToken(RenderedInstruction& result, const TokenKind kind,
+                         const uint64_t value = 0, const uint8_t size = 0) {
+  RenderedToken& token = result.tokens[result.count++];
+  token.kind = kind;
+  token.length = 0;
+  token.size = size;
+  token.value = value;
+  return token;
+}
+
+void Append(RenderedToken& token, const char* text) {
+  while (*text != '\0') {
+    token.text[token.length++] = *text++;
+  }
+}
+
+// Lowercase hex digits of every byte value, "00" through "ff"
+constexpr auto HEX_DIGITS = [] {
+  constexpr char digits[] = "0123456789abcdef";
+  std::array<std::array<char, 2>, 256> table{};
+  for (size_t i = 0; i < table.size(); i++) {
+    table[i] = {digits[i >> 4], digits[i & 0xF]};
+  }
+  return table;
+}();
+
+void AppendDigits(RenderedToken& token, const uint8_t value,
+                  const bool leadingZero) {
+  if (leadingZero || value >= 0x10) {
+    token.text[token.length++] = HEX_DIGITS[value][0];
+  }
+  token.text[token.length++] = HEX_DIGITS[value][1];
+}
+
+/*
+ * Operands follow the reference manual notation: # marks an immediate and $ a
+ * hexadecimal value, printed in lowercase without leading zeros. Digits are
+ * copied a byte at a time from HEX_DIGITS, e.g. 0x1234 -> "$" + "12" + "34".
+ */
+void AppendHex(RenderedToken& token, const uint16_t value) {
+  const uint8_t high = value >> 8;
+  token.text[token.length++] = '$';
+  if (high != 0) {
+    AppendDigits(token, high, false);
+  }
+  AppendDigits(token, value & 0xFF, high != 0);
+}
+}  // namespace
+
+/**
+ * RenderInstruction - Render disassembly text for any instruction from the
+ * token template of its addressing mode
+ * @param descriptor - descriptor of the instruction at data
+ * @param data       - instruction bytes, descriptor.length of them readable
+ * @param result     - filled with the mnemonic and operand tokens
+ */
+void RenderInstruction(const InstructionDescriptor& descriptor,
+                       const uint8_t* data, RenderedInstruction& result) {
+  result.count = 0;
+  Append(NextToken(result, TokenKind::MNEMONIC),
+         MnemonicToStr(descriptor.mnemonic));
+  const TextTemplate& tmpl = GetTemplate(descriptor);
+  if (tmpl.count == 0) {
+    return;
+  }
+  Append(NextToken(result, TokenKind::TEXT), " ");
+
+  // Indexed LDHX and the SP modes are 0x9E-prefixed; offsets count from the
+  // last opcode byte so the operands line up with the unprefixed forms
+  const uint8_t* operands = data + GetOpcodeLength(descriptor) - 1;
+  for (uint8_t i = 0; i < tmpl.count; i++) {
+    const TokenSlot& slot = tmpl.slots[i];
+    const uint8_t* field = operands + slot.offset;
+    switch (slot.field) {
+      case Field::SEPARATOR:
+        Append(NextToken(result, slot.kind), ",");
+        break;
+      case Field::REG_X:  // Index register H:X
+        Append(NextToken(result, slot.kind, Registers::HCS08_REG_HX), "X");
+        break;
+      case Field::REG_SP:
+        Append(NextToken(result, slot.kind, Registers::HCS08_REG_SP), "SP");
+        break;
+      case Field::POSTINC:
+        Append(NextToken(result, slot.kind), "+");
+        break;
+      case Field::BIT: {
+        const uint8_t bit = (data[0] & 0xF) >> 1;
+        RenderedToken& token = NextToken(result, slot.kind, bit, sizeof(bit));
+        token.text[token.length++] = static_cast<char>('0' + bit);
+        break;
+      }
+      case Field::HEX8:
+        AppendHex(NextToken(result, slot.kind, field[0], 1), field[0]);
+        break;
+      case Field::IMM8: {
+        RenderedToken& token = NextToken(result, slot.kind, field[0], 1);
+        Append(token, "#");
+        AppendHex(token, field[0]);
+        break;
+      }
+      case Field::HEX16: {
+        const uint16_t value = field[0] << 8 | field[1];
+        AppendHex(NextToken(result, slot.kind, value, sizeof(value)), value);
+        break;
+      }
+      case Field::IMM16: {
+        const uint16_t value = field[0] << 8 | field[1];
+        RenderedToken& token =
+            NextToken(result, slot.kind, value, sizeof(value));
+        Append(token, "#");
+        AppendHex(token, value);
+        break;
+      }
+      case Field::REL8:
+        AppendHex(NextToken(result, slot.kind, SignExtend(field[0]), 1),
+                  field[0]);
+        break;
+      case Field::REL16:
+      case Field::BSR_TARGET: {
+        int16_t offset = SignExtend(field[0]);
+        if (slot.field == Field::BSR_TARGET) {
+          offset += descriptor.length;
+        }
+        AppendHex(NextToken(result, slot.kind, offset, sizeof(offset)),
+                  offset);
+        break;
+      }
+    }
+  }
+}
+}  // namespace HCS08
@@ -0,0 +1,56 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_RENDER_H
+#define HCS08_RENDER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "descriptors.h"
+
+namespace HCS08 {
+/*
+ * Role of a rendered token; TextFromDescriptor maps each kind onto a
+ * BNInstructionTextTokenType, while text-only consumers ignore it
+ */
+enum class TokenKind : uint8_t {
+  MNEMONIC,
+  TEXT,
+  SEPARATOR,
+  REGISTER,
+  INTEGER,
+  ADDRESS,  // an integer that may be a memory address
+};
+
+/*
+ * One token of disassembly text, stored inline so rendering never touches
+ * the heap. The longest token is a 16-bit immediate, "#$ffff".
+ */
+struct RenderedToken {
+  static constexpr size_t MAX_TEXT = 7;
+
+  TokenKind kind;
+  uint8_t length;  // characters used in text
+  uint8_t size;    // operand size in bytes, 0 for static text
+  std::array<char, MAX_TEXT> text;
+  uint64_t value;  // operand value, sign-extended for relative offsets
+
+  std::string_view Text() const { return {text.data(), length}; }
+};
+
+// Mnemonic, space and up to six operand tokens (IX1_POSTINC_REL)
+struct RenderedInstruction {
+  static constexpr size_t MAX_TOKENS = 8;
+
+  uint8_t count = 0;
+  std::array<RenderedToken, MAX_TOKENS> tokens;
+};
+
+void RenderInstruction(const InstructionDescriptor& descriptor,
+                       const uint8_t* data, RenderedInstruction& result);
+}  // namespace HCS08
+
+#endif  // HCS08_RENDER_H
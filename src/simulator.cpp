@@ -0,0 +1,1207 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "simulator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "descriptors.h"
+#include "flags.h"
+#include "opcodes.h"
+#include "srecord.h"
+
+namespace HCS08 {
+namespace {
+// CCR bit masks; bits 5 and 6 always read as 1
+constexpr uint8_t CCR_C = 1 << Flags::FLAG_C;
+constexpr uint8_t CCR_Z = 1 << Flags::FLAG_Z;
+constexpr uint8_t CCR_N = 1 << Flags::FLAG_N;
+constexpr uint8_t CCR_I = 1 << Flags::FLAG_I;
+constexpr uint8_t CCR_H = 1 << Flags::FLAG_H;
+constexpr uint8_t CCR_V = 1 << Flags::FLAG_V;
+constexpr uint8_t CCR_ONES = 0x60;
+
+constexpr uint16_t SWI_VECTOR = 0xFFFC;
+
+// Return address pushed by Call; $0000 is a port register, never code
+constexpr uint16_t CALL_RETURN = 0x0000;
+
+// Bus cycles to stack the CPU registers and fetch a vector (same as SWI)
+constexpr uint8_t INTERRUPT_CYCLES = 11;
+
+// Longest run of instructions translated into one block
+constexpr uint32_t MAX_BLOCK = 32;
+
+/*
+ * Everything the translator needs about an opcode. Opcodes 0-255 are the
+ * primary page and 256-511 the 0x9E-prefixed page; undefined opcodes have
+ * mnemonic INVALID.
+ */
+struct Operation {
+  Mnemonic mnemonic;
+  AddressingMode mode;
+  uint8_t length;
+  uint8_t cycles;
+  bool endsBlock;  // may change control flow or stop the CPU
+};
+
+using OperationTable = std::array<Operation, 512>;
+
+const OperationTable& Operations() {
+  static const OperationTable table = [] {
+    OperationTable operations{};
+    for (size_t opcode = 0; opcode < operations.size(); opcode++) {
+      const uint8_t byte = opcode & 0xFF;
+      const std::array<uint8_t, 2> bytes =
+          opcode < 256 ? std::array<uint8_t, 2>{byte, 0}
+                       : std::array<uint8_t, 2>{OpcodeFields::EXT_OP, byte};
+      const InstructionDescriptor* descriptor =
+          opcode == OpcodeFields::EXT_OP ? nullptr
+                                         : LookupDescriptor(bytes.data());
+      if (descriptor == nullptr) {
+        operations[opcode] = {Mnemonic::INVALID, AddressingMode::INH, 0, 0,
+                              true};
+        continue;
+      }
+      const Mnemonic mnemonic = descriptor->mnemonic;
+      operations[opcode] = {
+          mnemonic, descriptor->mode, descriptor->length,
+          CycleCount(*descriptor),
+          descriptor->branch != BranchKind::NONE || mnemonic == Mnemonic::SWI ||
+              mnemonic == Mnemonic::STOP || mnemonic == Mnemonic::WAIT ||
+              mnemonic == Mnemonic::BGND};
+    }
+    return operations;
+  }();
+  return table;
+}
+
+// N and Z for an 8-bit result; bit 7 of the result lands on FLAG_N
+inline uint8_t NZ(const uint8_t result) {
+  return (result >> 5 & CCR_N) | (result == 0 ? CCR_Z : 0);
+}
+
+// N and Z for a 16-bit result (LDHX, STHX, CPHX)
+inline uint8_t NZ16(const uint16_t result) {
+  return (result >> 13 & CCR_N) | (result == 0 ? CCR_Z : 0);
+}
+
+// LDA, AND, STA...: V cleared, N and Z from the result
+inline uint8_t Logic(uint8_t& ccr, const uint8_t result) {
+  ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z)) | NZ(result);
+  return result;
+}
+
+// ADD/ADC: the carries out of bits 3 and 7 land on FLAG_H and FLAG_C, and the
+// signed overflow on FLAG_V
+inline uint8_t Add(uint8_t& ccr, const uint8_t a, const uint8_t m,
+                   const uint8_t carry) {
+  const unsigned sum = a + m + carry;
+  const auto result = static_cast<uint8_t>(sum);
+  ccr = (ccr & ~(CCR_V | CCR_H | CCR_N | CCR_Z | CCR_C)) | NZ(result) |
+        ((a ^ m ^ sum) & CCR_H) | (~(a ^ m) & (a ^ sum) & CCR_V) | sum >> 8;
+  return result;
+}
+
+// SUB/SBC/CMP/CPX: C is the borrow; H is not affected
+inline uint8_t Subtract(uint8_t& ccr, const uint8_t a, const uint8_t m,
+                        const uint8_t borrow) {
+  const unsigned difference = a - m - borrow;
+  const auto result = static_cast<uint8_t>(difference);
+  ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z | CCR_C)) | NZ(result) |
+        ((a ^ m) & (a ^ difference) & CCR_V) | (difference >> 8 & CCR_C);
+  return result;
+}
+
+// Shifts and rotates: C is the bit shifted out and V = N ^ C
+inline uint8_t Shift(uint8_t& ccr, const uint8_t result, const uint8_t carry) {
+  ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z | CCR_C)) | NZ(result) | carry |
+        ((result >> 7 ^ carry) != 0 ? CCR_V : 0);
+  return result;
+}
+
+// The read-modify-write group shared by the memory, A and X forms
+inline uint8_t Modify(const Mnemonic mnemonic, uint8_t& ccr,
+                      const uint8_t value) {
+  switch (mnemonic) {
+    case Mnemonic::NEG:
+    case Mnemonic::NEGA:
+    case Mnemonic::NEGX: {
+      const auto result = static_cast<uint8_t>(-value);
+      ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z | CCR_C)) | NZ(result) |
+            (result == 0x80 ? CCR_V : 0) | (result != 0 ? CCR_C : 0);
+      return result;
+    }
+    case Mnemonic::COM:
+    case Mnemonic::COMA:
+    case Mnemonic::COMX:
+      ccr |= CCR_C;
+      return Logic(ccr, ~value);
+    case Mnemonic::LSR:
+    case Mnemonic::LSRA:
+    case Mnemonic::LSRX:
+      return Shift(ccr, value >> 1, value & CCR_C);
+    case Mnemonic::ASR:
+    case Mnemonic::ASRA:
+    case Mnemonic::ASRX:
+      return Shift(ccr, (value >> 1) | (value & 0x80), value & CCR_C);
+    case Mnemonic::LSL:
+    case Mnemonic::LSLA:
+    case Mnemonic::LSLX:
+      return Shift(ccr, value << 1, value >> 7);
+    case Mnemonic::ROL:
+    case Mnemonic::ROLA:
+    case Mnemonic::ROLX:
+      return Shift(ccr, (value << 1) | (ccr & CCR_C), value >> 7);
+    case Mnemonic::ROR:
+    case Mnemonic::RORA:
+    case Mnemonic::RORX:
+      return Shift(ccr, (value >> 1) | (ccr & CCR_C) << 7, value & CCR_C);
+    case Mnemonic::DEC:
+    case Mnemonic::DECA:
+    case Mnemonic::DECX: {
+      const auto result = static_cast<uint8_t>(value - 1);
+      ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z)) | NZ(result) |
+            (result == 0x7F ? CCR_V : 0);
+      return result;
+    }
+    case Mnemonic::INC:
+    case Mnemonic::INCA:
+    case Mnemonic::INCX: {
+      const auto result = static_cast<uint8_t>(value + 1);
+      ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z)) | NZ(result) |
+            (result == 0x80 ? CCR_V : 0);
+      return result;
+    }
+    case Mnemonic::TST:
+    case Mnemonic::TSTA:
+    case Mnemonic::TSTX:
+      return Logic(ccr, value);
+    default:  // CLR, CLRA, CLRX
+      return Logic(ccr, 0);
+  }
+}
+
+// Cycles of the 8-bit read group (LDA, ADD, CMP...) per addressing mode
+uint8_t ReadCycles(const AddressingMode mode) {
+  switch (mode) {
+    case AddressingMode::IMM:
+      return 2;
+    case AddressingMode::DIR:
+    case AddressingMode::IX1:
+    case AddressingMode::IX:
+      return 3;
+    case AddressingMode::EXT:
+    case AddressingMode::IX2:
+    case AddressingMode::SP1:
+      return 4;
+    default:  // SP2
+      return 5;
+  }
+}
+
+// Cycles of the read-modify-write group (NEG, INC, CLR...); TST does not
+// write back and is one cycle shorter
+uint8_t ModifyCycles(const AddressingMode mode) {
+  switch (mode) {
+    case AddressingMode::INH:
+      return 1;
+    case AddressingMode::IX:
+      return 4;
+    case AddressingMode::SP1:
+      return 6;
+    default:  // DIR, IX1
+      return 5;
+  }
+}
+}  // namespace
+
+/**
+ * CycleCount - Bus cycles taken by an instruction, from the instruction set
+ * summary of the HCS08 reference manual. Branches take the same time whether
+ * or not they are taken.
+ * @param descriptor - the instruction
+ * @return cycle count, 0 for an undefined opcode
+ */
+uint8_t CycleCount(const InstructionDescriptor& descriptor) {
+  const AddressingMode mode = descriptor.mode;
+  switch (descriptor.mnemonic) {
+    case Mnemonic::ADC:
+    case Mnemonic::ADD:
+    case Mnemonic::AND:
+    case Mnemonic::BIT:
+    case Mnemonic::CMP:
+    case Mnemonic::CPX:
+    case Mnemonic::EOR:
+    case Mnemonic::LDA:
+    case Mnemonic::LDX:
+    case Mnemonic::ORA:
+    case Mnemonic::SBC:
+    case Mnemonic::SUB:
+      return ReadCycles(mode);
+    case Mnemonic::STA:
+    case Mnemonic::STX:
+      return mode == AddressingMode::IX ? 2 : ReadCycles(mode);
+    case Mnemonic::JMP:
+      return ReadCycles(mode);
+    case Mnemonic::JSR:
+      return ReadCycles(mode) + 2;
+    case Mnemonic::NEG:
+    case Mnemonic::NEGA:
+    case Mnemonic::NEGX:
+    case Mnemonic::COM:
+    case Mnemonic::COMA:
+    case Mnemonic::COMX:
+    case Mnemonic::LSR:
+    case Mnemonic::LSRA:
+    case Mnemonic::LSRX:
+    case Mnemonic::ROR:
+    case Mnemonic::RORA:
+    case Mnemonic::RORX:
+    case Mnemonic::ASR:
+    case Mnemonic::ASRA:
+    case Mnemonic::ASRX:
+    case Mnemonic::LSL:
+    case Mnemonic::LSLA:
+    case Mnemonic::LSLX:
+    case Mnemonic::ROL:
+    case Mnemonic::ROLA:
+    case Mnemonic::ROLX:
+    case Mnemonic::DEC:
+    case Mnemonic::DECA:
+    case Mnemonic::DECX:
+    case Mnemonic::INC:
+    case Mnemonic::INCA:
+    case Mnemonic::INCX:
+    case Mnemonic::CLR:
+    case Mnemonic::CLRA:
+    case Mnemonic::CLRX:
+      return ModifyCycles(mode);
+    case Mnemonic::TST:
+    case Mnemonic::TSTA:
+    case Mnemonic::TSTX:
+      return mode == AddressingMode::INH ? 1 : ModifyCycles(mode) - 1;
+    case Mnemonic::LDHX:
+      switch (mode) {
+        case AddressingMode::IMM16:
+          return 3;
+        case AddressingMode::DIR:
+          return 4;
+        case AddressingMode::IX2:
+          return 6;
+        default:  // EXT, IX, IX1, SP1
+          return 5;
+      }
+    case Mnemonic::STHX:
+      return mode == AddressingMode::DIR ? 4 : 5;
+    case Mnemonic::CPHX:
+      switch (mode) {
+        case AddressingMode::IMM16:
+          return 3;
+        case AddressingMode::DIR:
+          return 5;
+        default:  // EXT, SP1
+          return 6;
+      }
+    case Mnemonic::CBEQ:
+      switch (mode) {
+        case AddressingMode::IX_POSTINC_REL:
+          return 4;
+        case AddressingMode::SP1_REL:
+          return 6;
+        default:  // DIR_REL, IX1_POSTINC_REL
+          return 5;
+      }
+    case Mnemonic::CBEQA:
+    case Mnemonic::CBEQX:
+      return 4;
+    case Mnemonic::DBNZ:
+      switch (mode) {
+        case AddressingMode::IX_REL:
+          return 6;
+        case AddressingMode::SP1_REL:
+          return 8;
+        default:  // DIR_REL, IX1_REL
+          return 7;
+      }
+    case Mnemonic::DBNZA:
+    case Mnemonic::DBNZX:
+      return 4;
+    case Mnemonic::MOV:
+      return mode == AddressingMode::IMM_DIR ? 4 : 5;
+    case Mnemonic::BCC:
+    case Mnemonic::BCS:
+    case Mnemonic::BEQ:
+    case Mnemonic::BGE:
+    case Mnemonic::BGT:
+    case Mnemonic::BHCC:
+    case Mnemonic::BHCS:
+    case Mnemonic::BHI:
+    case Mnemonic::BIH:
+    case Mnemonic::BIL:
+    case Mnemonic::BLE:
+    case Mnemonic::BLS:
+    case Mnemonic::BLT:
+    case Mnemonic::BMC:
+    case Mnemonic::BMI:
+    case Mnemonic::BMS:
+    case Mnemonic::BNE:
+    case Mnemonic::BPL:
+    case Mnemonic::BRA:
+    case Mnemonic::BRN:
+      return 3;
+    case Mnemonic::BRCLR:
+    case Mnemonic::BRSET:
+    case Mnemonic::BCLR:
+    case Mnemonic::BSET:
+    case Mnemonic::BSR:
+    case Mnemonic::MUL:
+    case Mnemonic::BGND:
+      return 5;
+    case Mnemonic::AIS:
+    case Mnemonic::AIX:
+    case Mnemonic::PSHA:
+    case Mnemonic::PSHH:
+    case Mnemonic::PSHX:
+    case Mnemonic::TSX:
+    case Mnemonic::TXS:
+    case Mnemonic::STOP:
+    case Mnemonic::WAIT:
+      return 2;
+    case Mnemonic::PULA:
+    case Mnemonic::PULH:
+    case Mnemonic::PULX:
+      return 3;
+    case Mnemonic::DIV:
+    case Mnemonic::RTS:
+      return 6;
+    case Mnemonic::RTI:
+      return 9;
+    case Mnemonic::SWI:
+      return INTERRUPT_CYCLES;
+    case Mnemonic::INVALID:
+      return 0;
+    default:  // CLC, CLI, CLRH, DAA, NOP, NSA, RSP, SEC, SEI, TAP, TAX...
+      return 1;
+  }
+}
+
+Simulator::Simulator() : BLOCK_AT(MEMORY_SIZE, NO_BLOCK) {
+  STATE.ccr = CCR_ONES | CCR_I;
+}
+
+uint8_t* Simulator::Memory() { return MEMORY.data(); }
+
+const uint8_t* Simulator::Memory() const { return MEMORY.data(); }
+
+CpuState& Simulator::State() { return STATE; }
+
+const CpuState& Simulator::State() const { return STATE; }
+
+/**
+ * Load - Copy an image into memory at its load addresses; anything above
+ * $FFFF is dropped
+ * @param segments - image to load
+ */
+void Simulator::Load(const std::vector<MemorySegment>& segments) {
+  for (const MemorySegment& segment : segments) {
+    if (segment.address >= MEMORY_SIZE) {
+      continue;
+    }
+    const size_t length =
+        std::min(segment.data.size(), MEMORY_SIZE - segment.address);
+    std::copy_n(segment.data.begin(), length,
+                MEMORY.begin() + segment.address);
+    for (size_t page = segment.address / PAGE_SIZE;
+         page * PAGE_SIZE < segment.address + length; page++) {
+      MarkDirty(page);
+    }
+  }
+  Invalidate();
+}
+
+// Store outside of Run, e.g. when stacking registers for an interrupt
+void Simulator::Write(const uint16_t addr, const uint8_t value) {
+  MEMORY[addr] = value;
+  MarkDirty(addr / PAGE_SIZE);
+  if (CODE_PAGES[addr / PAGE_SIZE]) {
+    Invalidate();
+  }
+}
+
+/**
+ * Write - Copy bytes into memory, e.g. a fuzzing input, keeping track of the
+ * pages changed. Translated code is only dropped if a page of it changed.
+ * @param addr - where the first byte goes; the copy wraps at $FFFF
+ * @param data - bytes to copy
+ * @param size - number of bytes
+ */
+void Simulator::Write(const uint16_t addr, const uint8_t* data,
+                      const size_t size) {
+  bool stale = false;
+  for (size_t done = 0; done < size;) {
+    const size_t at = (addr + done) % MEMORY_SIZE;
+    const size_t length = std::min(size - done, PAGE_SIZE - at % PAGE_SIZE);
+    std::memcpy(&MEMORY[at], data + done, length);
+    MarkDirty(at / PAGE_SIZE);
+    stale |= CODE_PAGES[at / PAGE_SIZE];
+    done += length;
+  }
+  if (stale) {
+    Invalidate();
+  }
+}
+
+/**
+ * Invalidate - Drop every translated block. Run does this itself when the
+ * program stores into a translated page; call it after patching code through
+ * Memory().
+ */
+void Simulator::Invalidate() {
+  for (const Block& block : BLOCKS) {
+    BLOCK_AT[block.start] = NO_BLOCK;
+  }
+  BLOCKS.clear();
+  CODE.clear();
+  CODE_PAGES.fill(false);
+}
+
+void Simulator::MarkDirty(const size_t page) {
+  if (!DIRTY[page]) {
+    DIRTY[page] = true;
+    DIRTY_PAGES[DIRTY_COUNT++] = static_cast<uint8_t>(page);
+  }
+}
+
+/**
+ * Translate - Decode the straight-line run of instructions at start into a
+ * block: up to the first instruction that can branch, return or stop the
+ * CPU, or MAX_BLOCK instructions. Operands that do not depend on registers
+ * are resolved here, so each later pass through the block skips decoding.
+ * Every page the block's bytes come from is marked as code.
+ * @param start - address of the first instruction
+ * @return index of the new block in BLOCKS
+ */
+uint32_t Simulator::Translate(const uint16_t start) {
+  const OperationTable& operations = Operations();
+  const auto byte = [this](const uint16_t addr) { return MEMORY[addr]; };
+  const auto word = [this](const uint16_t addr) -> uint16_t {
+    return MEMORY[addr] << 8 | MEMORY[static_cast<uint16_t>(addr + 1)];
+  };
+
+  Block block{start, static_cast<uint32_t>(CODE.size()), 0};
+  uint16_t at = start;
+  while (true) {
+    uint8_t opcode = byte(at);
+    uint16_t p = at + 1;  // first operand byte
+    const Operation* op;
+    if (opcode == OpcodeFields::EXT_OP) {
+      opcode = byte(p++);
+      op = &operations[256 + opcode];
+    } else {
+      op = &operations[opcode];
+    }
+
+    Translated translated{};
+    translated.mnemonic = op->mnemonic;
+    translated.mode = op->mode;
+    translated.cycles = op->cycles;
+    translated.bit = opcode >> 1 & 7;
+    translated.next = at + op->length;
+    // The rel operand is always the last byte, relative to the next
+    // instruction
+    translated.target =
+        translated.next +
+        static_cast<int8_t>(byte(static_cast<uint16_t>(translated.next - 1)));
+
+    // Immediate operands are addressed in place, so every read is m[ea]
+    switch (op->mode) {
+      case AddressingMode::IMM:
+      case AddressingMode::IMM16:
+      case AddressingMode::IMM_REL:
+        translated.ea = p;
+        break;
+      case AddressingMode::IMM_DIR:
+        translated.ea = p;
+        translated.destination = byte(p + 1);
+        break;
+      case AddressingMode::DIR:
+      case AddressingMode::BIT_DIR:
+      case AddressingMode::BIT_DIR_REL:
+      case AddressingMode::DIR_REL:
+      case AddressingMode::DIR_IX_POSTINC:
+        translated.ea = byte(p);
+        break;
+      case AddressingMode::DIR_DIR:
+        translated.ea = byte(p);
+        translated.destination = byte(p + 1);
+        break;
+      case AddressingMode::EXT:
+        translated.ea = word(p);
+        break;
+      case AddressingMode::IX:
+      case AddressingMode::IX_REL:
+      case AddressingMode::IX_POSTINC_REL:
+        translated.base = EA_HX;
+        break;
+      case AddressingMode::IX_POSTINC_DIR:
+        translated.base = EA_HX;
+        translated.destination = byte(p);
+        break;
+      case AddressingMode::IX1:
+      case AddressingMode::IX1_REL:
+      case AddressingMode::IX1_POSTINC_REL:
+        translated.base = EA_HX;
+        translated.ea = byte(p);
+        break;
+      case AddressingMode::IX2:
+        translated.base = EA_HX;
+        translated.ea = word(p);
+        break;
+      case AddressingMode::SP1:
+      case AddressingMode::SP1_REL:
+        translated.base = EA_SP;
+        translated.ea = byte(p);
+        break;
+      case AddressingMode::SP2:
+        translated.base = EA_SP;
+        translated.ea = word(p);
+        break;
+      default:  // INH, REL, INH_REL
+        break;
+    }
+    CODE.push_back(translated);
+    block.count++;
+
+    // An undefined prefixed opcode is still decided by its second byte
+    const uint16_t last = at + std::max<uint16_t>(op->length, 2) - 1;
+    CODE_PAGES[at >> 8] = true;
+    CODE_PAGES[last >> 8] = true;
+
+    if (op->endsBlock || block.count == MAX_BLOCK) {
+      break;
+    }
+    at = translated.next;
+  }
+
+  BLOCKS.push_back(block);
+  BLOCK_AT[start] = static_cast<uint32_t>(BLOCKS.size() - 1);
+  return BLOCK_AT[start];
+}
+
+/**
+ * Reset - Put the CPU in its reset state: SP at $00FF, H cleared, interrupts
+ * masked, and PC fetched from the reset vector. Memory is left alone.
+ */
+void Simulator::Reset() {
+  STATE.sp = 0x00FF;
+  STATE.hx &= 0x00FF;
+  STATE.ccr = CCR_ONES | CCR_I;
+  STATE.pc = MEMORY[RESET_VECTOR] << 8 | MEMORY[RESET_VECTOR + 1];
+  STATE.cycles = 0;
+  STATE.instructions = 0;
+}
+
+/**
+ * Interrupt - Take a hardware interrupt as the CPU does between
+ * instructions: stack PC, X, A and CCR, mask interrupts and jump through the
+ * vector
+ * @param slot - address of the vector table entry, e.g. $FFFA for IRQ
+ * @return false, with nothing changed, if interrupts are masked
+ */
+bool Simulator::Interrupt(const uint16_t slot) {
+  CpuState& s = STATE;
+  if ((s.ccr & CCR_I) != 0) {
+    return false;
+  }
+  Write(s.sp--, s.pc & 0xFF);
+  Write(s.sp--, s.pc >> 8);
+  Write(s.sp--, s.hx & 0xFF);
+  Write(s.sp--, s.a);
+  Write(s.sp--, s.ccr);
+  s.ccr |= CCR_I;
+  s.pc = MEMORY[slot] << 8 | MEMORY[static_cast<uint16_t>(slot + 1)];
+  s.cycles += INTERRUPT_CYCLES;
+  return true;
+}
+
+/**
+ * TakeSnapshot - Save memory, the registers and the IRQ pin level. Dirty
+ * pages are counted from here on.
+ * @param snapshot - where to save them; any earlier contents are replaced
+ */
+void Simulator::TakeSnapshot(Snapshot& snapshot) {
+  static std::atomic<uint64_t> nextId = 1;
+  snapshot.MEMORY = MEMORY;
+  snapshot.STATE = STATE;
+  snapshot.IRQ_PIN = IRQ_PIN;
+  snapshot.ID = nextId.fetch_add(1, std::memory_order_relaxed);
+  BASE = snapshot.ID;
+  DIRTY.fill(false);
+  DIRTY_COUNT = 0;
+}
+
+/**
+ * Restore - Return to a snapshot. If memory last matched this snapshot, only
+ * the pages stored into since then are copied back; any other snapshot is
+ * copied in full. Translated code survives unless one of its pages changed.
+ * @param snapshot - snapshot from TakeSnapshot on this or another simulator
+ */
+void Simulator::Restore(const Snapshot& snapshot) {
+  if (snapshot.ID == BASE && BASE != 0) {
+    bool stale = false;
+    for (size_t i = 0; i < DIRTY_COUNT; i++) {
+      const size_t page = DIRTY_PAGES[i];
+      std::memcpy(&MEMORY[page * PAGE_SIZE], &snapshot.MEMORY[page * PAGE_SIZE],
+                  PAGE_SIZE);
+      DIRTY[page] = false;
+      stale |= CODE_PAGES[page];
+    }
+    if (stale) {
+      Invalidate();
+    }
+  } else {
+    MEMORY = snapshot.MEMORY;
+    BASE = snapshot.ID;
+    DIRTY.fill(false);
+    Invalidate();
+  }
+  DIRTY_COUNT = 0;
+  STATE = snapshot.STATE;
+  IRQ_PIN = snapshot.IRQ_PIN;
+}
+
+// Pages stored into since the last TakeSnapshot or Restore, in first-store
+// order; without a snapshot, every page stored into since construction
+std::span<const uint8_t> Simulator::DirtyPages() const {
+  return {DIRTY_PAGES.data(), DIRTY_COUNT};
+}
+
+// Level of the IRQ pin, tested by BIH and BIL; high (idle) after construction
+void Simulator::SetIrqPin(const bool high) { IRQ_PIN = high; }
+
+// Stop Run when PC reaches addr after an instruction; NO_BREAKPOINT disables
+void Simulator::SetBreakpoint(const uint32_t addr) { BREAKPOINT = addr; }
+
+StopReason Simulator::Step() { return Run(1); }
+
+/**
+ * Call - Run a subroutine to completion as if called with JSR, e.g. a
+ * checksum routine with its arguments already in A, H:X or on the stack
+ * @param target          - entry of the subroutine
+ * @param maxInstructions - give up after this many instructions
+ * @return BREAKPOINT once it returns, otherwise why it stopped early; PC is
+ * left at $0000 after a return
+ */
+StopReason Simulator::Call(const uint16_t target,
+                           const uint64_t maxInstructions) {
+  CpuState& s = STATE;
+  Write(s.sp--, CALL_RETURN & 0xFF);
+  Write(s.sp--, CALL_RETURN >> 8);
+  s.pc = target;
+
+  const uint32_t breakpoint = BREAKPOINT;
+  BREAKPOINT = CALL_RETURN;
+  const StopReason reason = Run(maxInstructions);
+  BREAKPOINT = breakpoint;
+  return reason;
+}
+
+/**
+ * Run - Execute instructions until one of the StopReason conditions. Code is
+ * executed a translated block at a time (see Translate); the registers live
+ * in locals for the duration of the loop and are written back on exit, and
+ * memory accesses wrap at 64 KB like the 16-bit address bus.
+ * @param maxInstructions - most instructions to execute
+ * @return why execution stopped
+ */
+StopReason Simulator::Run(const uint64_t maxInstructions) {
+  uint8_t* const m = MEMORY.data();
+  const bool* const codePages = CODE_PAGES.data();
+  bool* const dirty = DIRTY.data();
+  uint8_t* const dirtyPages = DIRTY_PAGES.data();
+  size_t dirtyCount = DIRTY_COUNT;
+  const uint32_t breakpoint = BREAKPOINT;
+  const bool irqPin = IRQ_PIN;
+
+  uint8_t a = STATE.a;
+  uint16_t hx = STATE.hx;
+  uint16_t sp = STATE.sp;
+  uint16_t pc = STATE.pc;
+  uint8_t ccr = STATE.ccr;
+  uint64_t cycles = STATE.cycles;
+  uint64_t executed = 0;
+  StopReason reason = StopReason::LIMIT;
+  bool stale = false;  // a store hit a translated page
+
+  const auto read16 = [m](const uint16_t addr) -> uint16_t {
+    return m[addr] << 8 | m[static_cast<uint16_t>(addr + 1)];
+  };
+  const auto store = [m, codePages, dirty, dirtyPages, &dirtyCount, &stale](
+                         const uint16_t addr, const uint8_t value) {
+    m[addr] = value;
+    const size_t page = addr / PAGE_SIZE;
+    stale |= codePages[page];
+    if (!dirty[page]) {
+      dirty[page] = true;
+      dirtyPages[dirtyCount++] = static_cast<uint8_t>(page);
+    }
+  };
+  const auto push = [&store, &sp](const uint8_t value) { store(sp--, value); };
+  const auto pull = [m, &sp]() { return m[++sp]; };
+  const auto setX = [&hx](const uint8_t x) { hx = (hx & 0xFF00) | x; };
+
+  while (executed < maxInstructions) {
+    uint32_t index = BLOCK_AT[pc];
+    if (index == NO_BLOCK) {
+      index = Translate(pc);
+    }
+    const Block& block = BLOCKS[index];
+    const Translated* d = &CODE[block.first];
+    const Translated* const end =
+        d + std::min<uint64_t>(block.count, maxInstructions - executed);
+    for (; d != end; ++d) {
+      uint16_t ea = d->ea;
+      if (d->base == EA_HX) {
+        ea += hx;
+      } else if (d->base == EA_SP) {
+        ea += sp;
+      }
+      const auto branch = [&pc, d](const bool taken) {
+        if (taken) {
+          pc = d->target;
+        }
+      };
+
+      pc = d->next;
+      switch (d->mnemonic) {
+        // Loads, stores and ALU operations
+        case Mnemonic::LDA:
+          a = Logic(ccr, m[ea]);
+          break;
+        case Mnemonic::LDX:
+          setX(Logic(ccr, m[ea]));
+          break;
+        case Mnemonic::STA:
+          store(ea, Logic(ccr, a));
+          break;
+        case Mnemonic::STX:
+          store(ea, Logic(ccr, hx & 0xFF));
+          break;
+        case Mnemonic::ADD:
+          a = Add(ccr, a, m[ea], 0);
+          break;
+        case Mnemonic::ADC:
+          a = Add(ccr, a, m[ea], ccr & CCR_C);
+          break;
+        case Mnemonic::SUB:
+          a = Subtract(ccr, a, m[ea], 0);
+          break;
+        case Mnemonic::SBC:
+          a = Subtract(ccr, a, m[ea], ccr & CCR_C);
+          break;
+        case Mnemonic::CMP:
+          Subtract(ccr, a, m[ea], 0);
+          break;
+        case Mnemonic::CPX:
+          Subtract(ccr, hx & 0xFF, m[ea], 0);
+          break;
+        case Mnemonic::AND:
+          a = Logic(ccr, a & m[ea]);
+          break;
+        case Mnemonic::ORA:
+          a = Logic(ccr, a | m[ea]);
+          break;
+        case Mnemonic::EOR:
+          a = Logic(ccr, a ^ m[ea]);
+          break;
+        case Mnemonic::BIT:
+          Logic(ccr, a & m[ea]);
+          break;
+
+        // 16-bit H:X operations
+        case Mnemonic::LDHX:
+          hx = read16(ea);
+          ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z)) | NZ16(hx);
+          break;
+        case Mnemonic::STHX:
+          store(ea, hx >> 8);
+          store(static_cast<uint16_t>(ea + 1), hx & 0xFF);
+          ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z)) | NZ16(hx);
+          break;
+        case Mnemonic::CPHX: {
+          const uint16_t operand = read16(ea);
+          const uint32_t difference = hx - operand;
+          ccr = (ccr & ~(CCR_V | CCR_N | CCR_Z | CCR_C)) |
+                NZ16(static_cast<uint16_t>(difference)) |
+                (((hx ^ operand) & (hx ^ difference) & 0x8000) != 0 ? CCR_V
+                                                                    : 0) |
+                (difference >> 16 & CCR_C);
+          break;
+        }
+        case Mnemonic::AIX:
+          hx += static_cast<int8_t>(m[ea]);
+          break;
+        case Mnemonic::AIS:
+          sp += static_cast<int8_t>(m[ea]);
+          break;
+
+        // Read-modify-write on memory, A or X
+        case Mnemonic::NEG:
+        case Mnemonic::COM:
+        case Mnemonic::LSR:
+        case Mnemonic::ROR:
+        case Mnemonic::ASR:
+        case Mnemonic::LSL:
+        case Mnemonic::ROL:
+        case Mnemonic::DEC:
+        case Mnemonic::INC:
+        case Mnemonic::CLR:
+          store(ea, Modify(d->mnemonic, ccr, m[ea]));
+          break;
+        case Mnemonic::TST:
+          Modify(d->mnemonic, ccr, m[ea]);
+          break;
+        case Mnemonic::NEGA:
+        case Mnemonic::COMA:
+        case Mnemonic::LSRA:
+        case Mnemonic::RORA:
+        case Mnemonic::ASRA:
+        case Mnemonic::LSLA:
+        case Mnemonic::ROLA:
+        case Mnemonic::DECA:
+        case Mnemonic::INCA:
+        case Mnemonic::TSTA:
+        case Mnemonic::CLRA:
+          a = Modify(d->mnemonic, ccr, a);
+          break;
+        case Mnemonic::NEGX:
+        case Mnemonic::COMX:
+        case Mnemonic::LSRX:
+        case Mnemonic::RORX:
+        case Mnemonic::ASRX:
+        case Mnemonic::LSLX:
+        case Mnemonic::ROLX:
+        case Mnemonic::DECX:
+        case Mnemonic::INCX:
+        case Mnemonic::TSTX:
+        case Mnemonic::CLRX:
+          setX(Modify(d->mnemonic, ccr, hx & 0xFF));
+          break;
+        case Mnemonic::CLRH:
+          hx &= 0x00FF;
+          break;
+
+        // Multiply, divide and BCD
+        case Mnemonic::MUL: {
+          const uint16_t product = (hx & 0xFF) * a;
+          a = product & 0xFF;
+          setX(product >> 8);
+          ccr &= ~(CCR_H | CCR_C);
+          break;
+        }
+        case Mnemonic::DIV: {
+          // A = H:A / X and H = remainder; on overflow or divide by zero only
+          // C is set and the registers are left as they were
+          const uint16_t dividend = (hx & 0xFF00) | a;
+          const uint8_t divisor = hx & 0xFF;
+          if (divisor == 0 || dividend / divisor > 0xFF) {
+            ccr |= CCR_C;
+            break;
+          }
+          a = dividend / divisor;
+          hx = (dividend % divisor) << 8 | divisor;
+          ccr = (ccr & ~(CCR_Z | CCR_C)) | (a == 0 ? CCR_Z : 0);
+          break;
+        }
+        case Mnemonic::NSA:
+          a = static_cast<uint8_t>(a << 4 | a >> 4);
+          break;
+        case Mnemonic::DAA: {
+          uint8_t correction = 0;
+          uint8_t carry = ccr & CCR_C;
+          if ((ccr & CCR_H) != 0 || (a & 0x0F) > 0x09) {
+            correction |= 0x06;
+          }
+          if (carry != 0 || a > 0x99) {
+            correction |= 0x60;
+            carry = CCR_C;
+          }
+          a += correction;
+          ccr = (ccr & ~(CCR_N | CCR_Z | CCR_C)) | NZ(a) | carry;
+          break;
+        }
+
+        // Register transfers and the stack
+        case Mnemonic::TAX:
+          setX(a);
+          break;
+        case Mnemonic::TXA:
+          a = hx & 0xFF;
+          break;
+        case Mnemonic::TAP:
+          ccr = a | CCR_ONES;
+          break;
+        case Mnemonic::TPA:
+          a = ccr;
+          break;
+        case Mnemonic::TSX:
+          hx = sp + 1;
+          break;
+        case Mnemonic::TXS:
+          sp = hx - 1;
+          break;
+        case Mnemonic::RSP:
+          sp |= 0x00FF;
+          break;
+        case Mnemonic::PSHA:
+          push(a);
+          break;
+        case Mnemonic::PSHX:
+          push(hx & 0xFF);
+          break;
+        case Mnemonic::PSHH:
+          push(hx >> 8);
+          break;
+        case Mnemonic::PULA:
+          a = pull();
+          break;
+        case Mnemonic::PULX:
+          setX(pull());
+          break;
+        case Mnemonic::PULH:
+          hx = (hx & 0x00FF) | pull() << 8;
+          break;
+        case Mnemonic::MOV: {
+          const uint8_t value = Logic(ccr, m[ea]);
+          switch (d->mode) {
+            case AddressingMode::DIR_IX_POSTINC:
+              store(hx++, value);
+              break;
+            case AddressingMode::IX_POSTINC_DIR:
+              store(d->destination, value);
+              hx++;
+              break;
+            default:  // DIR_DIR, IMM_DIR
+              store(d->destination, value);
+              break;
+          }
+          break;
+        }
+
+        // CCR bits
+        case Mnemonic::CLC:
+          ccr &= ~CCR_C;
+          break;
+        case Mnemonic::SEC:
+          ccr |= CCR_C;
+          break;
+        case Mnemonic::CLI:
+          ccr &= ~CCR_I;
+          break;
+        case Mnemonic::SEI:
+          ccr |= CCR_I;
+          break;
+
+        // Bit manipulation
+        case Mnemonic::BSET:
+          store(ea, m[ea] | 1 << d->bit);
+          break;
+        case Mnemonic::BCLR:
+          store(ea, m[ea] & ~(1 << d->bit));
+          break;
+        case Mnemonic::BRSET:
+        case Mnemonic::BRCLR: {
+          // The tested bit is copied to C
+          const uint8_t bit = m[ea] >> d->bit & 1;
+          ccr = (ccr & ~CCR_C) | bit;
+          branch(bit == (d->mnemonic == Mnemonic::BRSET ? 1 : 0));
+          break;
+        }
+
+        // Branches
+        case Mnemonic::BRA:
+          branch(true);
+          break;
+        case Mnemonic::BRN:
+          break;
+        case Mnemonic::BEQ:
+          branch((ccr & CCR_Z) != 0);
+          break;
+        case Mnemonic::BNE:
+          branch((ccr & CCR_Z) == 0);
+          break;
+        case Mnemonic::BCC:
+          branch((ccr & CCR_C) == 0);
+          break;
+        case Mnemonic::BCS:
+          branch((ccr & CCR_C) != 0);
+          break;
+        case Mnemonic::BPL:
+          branch((ccr & CCR_N) == 0);
+          break;
+        case Mnemonic::BMI:
+          branch((ccr & CCR_N) != 0);
+          break;
+        case Mnemonic::BHCC:
+          branch((ccr & CCR_H) == 0);
+          break;
+        case Mnemonic::BHCS:
+          branch((ccr & CCR_H) != 0);
+          break;
+        case Mnemonic::BMC:
+          branch((ccr & CCR_I) == 0);
+          break;
+        case Mnemonic::BMS:
+          branch((ccr & CCR_I) != 0);
+          break;
+        case Mnemonic::BIH:
+          branch(irqPin);
+          break;
+        case Mnemonic::BIL:
+          branch(!irqPin);
+          break;
+        case Mnemonic::BHI:
+          branch((ccr & (CCR_C | CCR_Z)) == 0);
+          break;
+        case Mnemonic::BLS:
+          branch((ccr & (CCR_C | CCR_Z)) != 0);
+          break;
+        case Mnemonic::BGE:
+          branch(((ccr & CCR_N) != 0) == ((ccr & CCR_V) != 0));
+          break;
+        case Mnemonic::BLT:
+          branch(((ccr & CCR_N) != 0) != ((ccr & CCR_V) != 0));
+          break;
+        case Mnemonic::BGT:
+          branch((ccr & CCR_Z) == 0 &&
+                 ((ccr & CCR_N) != 0) == ((ccr & CCR_V) != 0));
+          break;
+        case Mnemonic::BLE:
+          branch((ccr & CCR_Z) != 0 ||
+                 ((ccr & CCR_N) != 0) != ((ccr & CCR_V) != 0));
+          break;
+        case Mnemonic::CBEQ:
+          branch(a == m[ea]);
+          if (d->mode == AddressingMode::IX_POSTINC_REL ||
+              d->mode == AddressingMode::IX1_POSTINC_REL) {
+            hx++;
+          }
+          break;
+        case Mnemonic::CBEQA:
+          branch(a == m[ea]);
+          break;
+        case Mnemonic::CBEQX:
+          branch((hx & 0xFF) == m[ea]);
+          break;
+        case Mnemonic::DBNZ:
+          store(ea, m[ea] - 1);
+          branch(m[ea] != 0);
+          break;
+        case Mnemonic::DBNZA:
+          branch(--a != 0);
+          break;
+        case Mnemonic::DBNZX: {
+          const uint8_t x = (hx & 0xFF) - 1;
+          setX(x);
+          branch(x != 0);
+          break;
+        }
+
+        // Jumps, calls and returns
+        case Mnemonic::JMP:
+          pc = ea;
+          break;
+        case Mnemonic::BSR:
+          push(d->next & 0xFF);
+          push(d->next >> 8);
+          branch(true);
+          break;
+        case Mnemonic::JSR:
+          push(d->next & 0xFF);
+          push(d->next >> 8);
+          pc = ea;
+          break;
+        case Mnemonic::RTS:
+          pc = pull() << 8;
+          pc |= pull();
+          break;
+        case Mnemonic::RTI:
+          ccr = pull() | CCR_ONES;
+          a = pull();
+          setX(pull());
+          pc = pull() << 8;
+          pc |= pull();
+          break;
+        case Mnemonic::SWI:
+          push(d->next & 0xFF);
+          push(d->next >> 8);
+          push(hx & 0xFF);
+          push(a);
+          push(ccr);
+          ccr |= CCR_I;
+          pc = read16(SWI_VECTOR);
+          break;
+
+        // Halts
+        case Mnemonic::NOP:
+          break;
+        case Mnemonic::STOP:
+          ccr &= ~CCR_I;
+          reason = StopReason::STOP;
+          break;
+        case Mnemonic::WAIT:
+          ccr &= ~CCR_I;
+          reason = StopReason::WAIT;
+          break;
+        case Mnemonic::BGND:
+          reason = StopReason::BACKGROUND;
+          break;
+        default:
+          // INVALID; the hardware would take an illegal opcode reset. An
+          // undefined opcode has length 0, so PC stays on it.
+          reason = StopReason::ILLEGAL;
+          break;
+      }
+      if (reason != StopReason::ILLEGAL) {
+        cycles += d->cycles;
+        executed++;
+      }
+      if (reason != StopReason::LIMIT || stale || pc == breakpoint) {
+        break;
+      }
+    }
+
+    // A store hit a translated page: the rest of this block, and any other
+    // block from that page, may no longer match memory
+    if (stale) {
+      Invalidate();
+      stale = false;
+    }
+    if (reason != StopReason::LIMIT) {
+      break;
+    }
+    if (pc == breakpoint) {
+      reason = StopReason::BREAKPOINT;
+      break;
+    }
+  }
+
+  STATE.a = a;
+  STATE.hx = hx;
+  STATE.sp = sp;
+  STATE.pc = pc;
+  STATE.ccr = ccr;
+  STATE.cycles = cycles;
+  STATE.instructions += executed;
+  DIRTY_COUNT = dirtyCount;
+  return reason;
+}
+}  // namespace HCS08
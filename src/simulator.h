@@ -0,0 +1,155 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_SIMULATOR_H
+#define HCS08_SIMULATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "descriptors.h"
+#include "srecord.h"
+
+namespace HCS08 {
+// Why Simulator::Run returned
+enum class StopReason : uint8_t {
+  LIMIT,       // executed the requested number of instructions
+  BREAKPOINT,  // PC reached the breakpoint (or a Call returned)
+  STOP,        // STOP executed; PC is after it
+  WAIT,        // WAIT executed; PC is after it
+  BACKGROUND,  // BGND executed; PC is after it
+  ILLEGAL,     // undefined opcode; PC is left on it
+};
+
+/*
+ * Programmer's model of the CPU. X is the low byte of hx and H the high byte,
+ * as in the lifter; ccr uses the layout in flags.h.
+ */
+struct CpuState {
+  uint8_t a = 0;
+  uint16_t hx = 0;
+  uint16_t sp = 0x00FF;
+  uint16_t pc = 0;
+  uint8_t ccr = 0;
+  uint64_t cycles = 0;        // bus cycles since Reset
+  uint64_t instructions = 0;  // instructions retired since Reset
+};
+
+/*
+ * Instruction-set simulator for running firmware routines (self-tests,
+ * checksums) without the target. Memory is a flat 64 KB array with no
+ * peripherals; opcodes are decoded from the same descriptor pages as the
+ * architecture, and every instruction is charged its cycle count from the
+ * HCS08 reference manual.
+ *
+ * Code is decoded once into blocks of pre-decoded instructions, cached by
+ * start address. A store into a 256-byte page that holds translated code
+ * drops the cache, so self-modifying and RAM-resident code stay correct.
+ *
+ * Every 256-byte page the simulator stores into is noted as dirty, so a
+ * Snapshot can be restored by copying back only those pages. Changes made
+ * directly through Memory() are not tracked; make them with Write.
+ */
+class Simulator {
+ public:
+  static constexpr size_t MEMORY_SIZE = 0x10000;
+  static constexpr size_t PAGE_SIZE = 0x100;
+  static constexpr uint32_t NO_BREAKPOINT = 0x10000;
+
+  /*
+   * Registers, IRQ pin level and memory saved by TakeSnapshot, e.g. a
+   * fuzzing target after its initialization. Memory is copied in full once;
+   * restoring it into the simulator that took it copies only dirty pages.
+   */
+  class Snapshot {
+   private:
+    friend class Simulator;
+
+    std::array<uint8_t, MEMORY_SIZE> MEMORY{};
+    CpuState STATE;
+    bool IRQ_PIN = true;
+    uint64_t ID = 0;  // 0 until taken; unique per TakeSnapshot call
+  };
+
+  Simulator();
+
+  uint8_t* Memory();
+  const uint8_t* Memory() const;
+  CpuState& State();
+  const CpuState& State() const;
+
+  void Load(const std::vector<MemorySegment>& segments);
+  void Write(uint16_t addr, uint8_t value);
+  void Write(uint16_t addr, const uint8_t* data, size_t size);
+  void Invalidate();
+  void Reset();
+  void TakeSnapshot(Snapshot& snapshot);
+  void Restore(const Snapshot& snapshot);
+  std::span<const uint8_t> DirtyPages() const;
+  bool Interrupt(uint16_t slot);
+  void SetIrqPin(bool high);
+  void SetBreakpoint(uint32_t addr);
+
+  StopReason Run(uint64_t maxInstructions);
+  StopReason Step();
+  StopReason Call(uint16_t target, uint64_t maxInstructions);
+
+ private:
+  static constexpr uint32_t NO_BLOCK = UINT32_MAX;
+  static constexpr size_t PAGE_COUNT = MEMORY_SIZE / PAGE_SIZE;
+
+  // How Translated::ea becomes the effective address at run time
+  static constexpr uint8_t EA_ABSOLUTE = 0;  // ea as is
+  static constexpr uint8_t EA_HX = 1;        // ea + H:X
+  static constexpr uint8_t EA_SP = 2;        // ea + SP
+
+  /*
+   * One pre-decoded instruction. Immediate, direct and extended operands are
+   * resolved to ea when translated; indexed operands keep their offset.
+   */
+  struct Translated {
+    Mnemonic mnemonic;
+    AddressingMode mode;
+    uint8_t base;         // EA_ABSOLUTE, EA_HX or EA_SP
+    uint8_t cycles;
+    uint8_t bit;          // bit number of BSET/BCLR/BRSET/BRCLR
+    uint8_t destination;  // direct page destination of MOV
+    uint16_t ea;
+    uint16_t next;    // address of the following instruction
+    uint16_t target;  // taken destination of a relative branch
+  };
+
+  // A run of CODE entries starting at address start
+  struct Block {
+    uint16_t start;
+    uint32_t first;
+    uint32_t count;
+  };
+
+  uint32_t Translate(uint16_t start);
+  void MarkDirty(size_t page);
+
+  std::array<uint8_t, MEMORY_SIZE> MEMORY{};
+  CpuState STATE;
+  uint32_t BREAKPOINT = NO_BREAKPOINT;
+  bool IRQ_PIN = true;
+
+  std::vector<Translated> CODE;
+  std::vector<Block> BLOCKS;
+  std::vector<uint32_t> BLOCK_AT;  // block index by start address
+  std::array<bool, PAGE_COUNT> CODE_PAGES{};
+
+  // Pages stored into since the snapshot memory was last restored or taken
+  std::array<bool, PAGE_COUNT> DIRTY{};
+  std::array<uint8_t, PAGE_COUNT> DIRTY_PAGES{};  // the DIRTY pages, in order
+  size_t DIRTY_COUNT = 0;
+  uint64_t BASE = 0;  // Snapshot::ID that memory matches outside dirty pages
+};
+
+uint8_t CycleCount(const InstructionDescriptor& descriptor);
+}  // namespace HCS08
+
+#endif  // HCS08_SIMULATOR_H
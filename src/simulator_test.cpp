@@ -0,0 +1,232 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "descriptors.h"
+#include "flags.h"
+#include "opcodes.h"
+#include "simulator.h"
+#include "srecord.h"
+
+namespace {
+constexpr uint16_t CODE = 0x8000;
+
+// A simulator with code at CODE and the reset vector pointing to it
+std::unique_ptr<HCS08::Simulator> Boot(const std::vector<uint8_t>& code) {
+  auto simulator = std::make_unique<HCS08::Simulator>();
+  simulator->Load({{CODE, code}, {HCS08::RESET_VECTOR, {CODE >> 8, 0x00}}});
+  simulator->Reset();
+  return simulator;
+}
+
+bool Flag(const HCS08::Simulator& simulator, const uint8_t flag) {
+  return (simulator.State().ccr >> flag & 1) != 0;
+}
+
+uint8_t Cycles(const std::vector<uint8_t>& bytes) {
+  return HCS08::CycleCount(*HCS08::LookupDescriptor(bytes.data()));
+}
+}  // namespace
+
+// Test a byte-sum checksum loop run as a subroutine, counting every cycle
+TEST(TestSimulator, TestChecksum) {
+  auto simulator = Boot({
+      HCS08::Opcodes::LDHX_IMM, 0xC0, 0x00,     // ldhx #$C000
+      HCS08::Opcodes::CLRA_INH,                 // clra
+      HCS08::Opcodes::MOV_IMM_DIR, 0x10, 0x80,  // mov #16,$80
+      HCS08::Opcodes::ADD_IX,                   // loop: add ,x
+      HCS08::Opcodes::AIX_IMM, 0x01,            // aix #1
+      HCS08::Opcodes::DBNZ_DIR, 0x80, 0xFA,     // dbnz $80,loop
+      HCS08::Opcodes::RTS_INH,                  // rts
+  });
+  uint8_t expected = 0;
+  for (size_t i = 0; i < 16; i++) {
+    simulator->Memory()[0xC000 + i] = static_cast<uint8_t>(i * 37 + 11);
+    expected += static_cast<uint8_t>(i * 37 + 11);
+  }
+
+  EXPECT_EQ(simulator->Call(CODE, 1000), HCS08::StopReason::BREAKPOINT);
+  EXPECT_EQ(simulator->State().a, expected);
+  EXPECT_EQ(simulator->State().hx, 0xC010);
+  EXPECT_EQ(simulator->State().sp, 0x00FF);
+  EXPECT_EQ(simulator->State().instructions, 3 + 16 * 3 + 1);
+  EXPECT_EQ(simulator->State().cycles, 3 + 1 + 4 + 16 * (3 + 2 + 7) + 6);
+}
+
+// Test the arithmetic flags, including half-carry and overflow
+TEST(TestSimulator, TestFlags) {
+  auto simulator = Boot({
+      HCS08::Opcodes::LDA_IMM, 0x7F,  // lda #$7F
+      HCS08::Opcodes::ADD_IMM, 0x01,  // add #1
+      HCS08::Opcodes::SUB_IMM, 0x81,  // sub #$81
+      HCS08::Opcodes::LSRA_INH,       // lsra
+  });
+
+  simulator->Step();
+  simulator->Step();
+  EXPECT_EQ(simulator->State().a, 0x80);
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_V));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_H));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_N));
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_Z));
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_C));
+
+  simulator->Step();
+  EXPECT_EQ(simulator->State().a, 0xFF);
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_V));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_N));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_C));
+
+  // V = N ^ C after a shift
+  simulator->Step();
+  EXPECT_EQ(simulator->State().a, 0x7F);
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_N));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_C));
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_V));
+}
+
+// Test DIV and MUL on H:A, X and X:A
+TEST(TestSimulator, TestDivideMultiply) {
+  auto simulator = Boot({
+      HCS08::Opcodes::LDHX_IMM, 0x01, 0x07,  // ldhx #$0107
+      HCS08::Opcodes::LDA_IMM, 0x2C,         // lda #$2C
+      HCS08::Opcodes::DIV_INH,               // div: 300 / 7
+      HCS08::Opcodes::MUL_INH,               // mul: 7 * 42
+  });
+
+  EXPECT_EQ(simulator->Run(3), HCS08::StopReason::LIMIT);
+  EXPECT_EQ(simulator->State().a, 42);
+  EXPECT_EQ(simulator->State().hx, 0x0607);
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_C));
+
+  simulator->Step();
+  EXPECT_EQ(simulator->State().a, 0x26);
+  EXPECT_EQ(simulator->State().hx & 0xFF, 0x01);
+}
+
+// Test that a store into translated code is seen by the next instruction
+TEST(TestSimulator, TestSelfModifyingCode) {
+  const std::vector<uint8_t> code = {
+      HCS08::Opcodes::LDA_IMM, HCS08::Opcodes::INCA_INH,  // lda #<inca>
+      HCS08::Opcodes::STA_EXT, 0x01, 0x05,                // sta $0105
+      HCS08::Opcodes::CLRA_INH,                           // clra -> inca
+      HCS08::Opcodes::RTS_INH,                            // rts
+  };
+  auto simulator = Boot({});
+  simulator->Load({{0x0100, code}});
+
+  EXPECT_EQ(simulator->Call(0x0100, 10), HCS08::StopReason::BREAKPOINT);
+  EXPECT_EQ(simulator->State().a, HCS08::Opcodes::INCA_INH + 1);
+}
+
+// Test that a snapshot restores memory, registers and the translated code
+// from only the pages stored into, and restores in full elsewhere
+TEST(TestSimulator, TestSnapshot) {
+  const std::vector<uint8_t> code = {
+      HCS08::Opcodes::LDA_IMM, HCS08::Opcodes::INCA_INH,  // lda #<inca>
+      HCS08::Opcodes::STA_EXT, 0x01, 0x05,                // sta $0105
+      HCS08::Opcodes::CLRA_INH,                           // clra -> inca
+      HCS08::Opcodes::RTS_INH,                            // rts
+  };
+  auto simulator = Boot({});
+  simulator->Load({{0x0100, code}});
+  simulator->State().a = 0x42;
+  const auto snapshot = std::make_unique<HCS08::Simulator::Snapshot>();
+  simulator->TakeSnapshot(*snapshot);
+  EXPECT_TRUE(simulator->DirtyPages().empty());
+
+  const uint8_t input[] = {1, 2, 3};
+  simulator->Write(0x20FE, input, sizeof(input));
+  EXPECT_EQ(simulator->Call(0x0100, 10), HCS08::StopReason::BREAKPOINT);
+  EXPECT_EQ(std::vector<uint8_t>(simulator->DirtyPages().begin(),
+                                 simulator->DirtyPages().end()),
+            std::vector<uint8_t>({0x20, 0x21, 0x00, 0x01}));
+
+  simulator->Restore(*snapshot);
+  EXPECT_TRUE(simulator->DirtyPages().empty());
+  EXPECT_EQ(simulator->Memory()[0x0105], HCS08::Opcodes::CLRA_INH);
+  EXPECT_EQ(simulator->Memory()[0x20FF], 0);
+  EXPECT_EQ(simulator->State().a, 0x42);
+  EXPECT_EQ(simulator->State().sp, 0x00FF);
+  EXPECT_EQ(simulator->State().instructions, 0);
+  EXPECT_EQ(simulator->Call(0x0105, 10), HCS08::StopReason::BREAKPOINT);
+  EXPECT_EQ(simulator->State().a, 0);  // clra, not the inca stored before
+
+  auto other = std::make_unique<HCS08::Simulator>();
+  other->Restore(*snapshot);
+  simulator->Restore(*snapshot);
+  EXPECT_EQ(other->State().a, 0x42);
+  EXPECT_TRUE(std::equal(other->Memory(),
+                         other->Memory() + HCS08::Simulator::MEMORY_SIZE,
+                         simulator->Memory()));
+}
+
+// Test that SWI stacks the registers and RTI restores them
+TEST(TestSimulator, TestSoftwareInterrupt) {
+  auto simulator = Boot({HCS08::Opcodes::SWI_INH});
+  simulator->Load({{0x9000, {HCS08::Opcodes::RTI_INH}}, {0xFFFC, {0x90, 0}}});
+  simulator->State().ccr &= ~(1 << HCS08::Flags::FLAG_I);
+
+  simulator->Step();
+  EXPECT_EQ(simulator->State().pc, 0x9000);
+  EXPECT_EQ(simulator->State().sp, 0x00FA);
+  EXPECT_TRUE(Flag(*simulator, HCS08::Flags::FLAG_I));
+  EXPECT_EQ(simulator->State().cycles, 11);
+
+  simulator->Step();
+  EXPECT_EQ(simulator->State().pc, CODE + 1);
+  EXPECT_EQ(simulator->State().sp, 0x00FF);
+  EXPECT_FALSE(Flag(*simulator, HCS08::Flags::FLAG_I));
+}
+
+// Test that execution stops on an undefined opcode and on STOP
+TEST(TestSimulator, TestStops) {
+  auto simulator = Boot({HCS08::Opcodes::STOP_INH, 0xAC});
+
+  EXPECT_EQ(simulator->Run(10), HCS08::StopReason::STOP);
+  EXPECT_EQ(simulator->State().pc, CODE + 1);
+  EXPECT_EQ(simulator->Run(10), HCS08::StopReason::ILLEGAL);
+  EXPECT_EQ(simulator->State().pc, CODE + 1);
+  EXPECT_EQ(simulator->State().instructions, 1);
+}
+
+// Test cycle counts against the reference manual
+TEST(TestSimulator, TestCycleCounts) {
+  EXPECT_EQ(Cycles({HCS08::Opcodes::LDA_IMM}), 2);
+  EXPECT_EQ(Cycles({HCS08::Opcodes::STA_IX}), 2);
+  EXPECT_EQ(Cycles({HCS08::Opcodes::JSR_EXT}), 6);
+  EXPECT_EQ(Cycles({HCS08::Opcodes::BRSET_DIR_B3}), 5);
+  EXPECT_EQ(Cycles({HCS08::Opcodes::RTI_INH}), 9);
+  EXPECT_EQ(Cycles({HCS08::OpcodeFields::EXT_OP, 0xE6}), 4);  // LDA oprx8,SP
+  EXPECT_EQ(Cycles({HCS08::OpcodeFields::EXT_OP, 0x6B}), 8);  // DBNZ SP1
+}
+
+// Test the 16-bit index register instructions in every addressing mode
+// against the reference manual's cycle counts
+TEST(TestSimulator, TestIndexCycleCounts) {
+  const std::vector<std::pair<uint32_t, uint8_t>> cycles = {
+      {HCS08::Opcodes::LDHX_IMM, 3}, {HCS08::Opcodes::LDHX_DIR, 4},
+      {HCS08::Opcodes::LDHX_EXT, 5}, {HCS08::Opcodes::LDHX_IX, 5},
+      {HCS08::Opcodes::LDHX_IX1, 5}, {HCS08::Opcodes::LDHX_IX2, 6},
+      {HCS08::Opcodes::LDHX_SP1, 5}, {HCS08::Opcodes::STHX_DIR, 4},
+      {HCS08::Opcodes::STHX_EXT, 5}, {HCS08::Opcodes::STHX_SP1, 5},
+      {HCS08::Opcodes::CPHX_IMM, 3}, {HCS08::Opcodes::CPHX_DIR, 5},
+      {HCS08::Opcodes::CPHX_EXT, 6}, {HCS08::Opcodes::CPHX_SP1, 6},
+  };
+  for (const auto& [opcode, expected] : cycles) {
+    const std::vector<uint8_t> bytes =
+        opcode > 0xFF ? std::vector<uint8_t>{static_cast<uint8_t>(opcode >> 8),
+                                             static_cast<uint8_t>(opcode)}
+                      : std::vector<uint8_t>{static_cast<uint8_t>(opcode)};
+    EXPECT_EQ(Cycles(bytes), expected) << HCS08::Opcodes::NAMES.at(opcode)
+                                       << " " << std::hex << opcode;
+  }
+}
@@ -0,0 +1,377 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "srecord.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace HCS08 {
+namespace {
+// Data bytes per S1 record, the common choice of HCS08 toolchains
+constexpr size_t SRECORD_DATA_BYTES = 32;
+
+void AppendRecord(std::string& out, const char type, const uint16_t address,
+                  const uint8_t* data, const size_t len) {
+  static constexpr char HEX[] = "0123456789ABCDEF";
+  const auto appendByte = [&out](const uint8_t byte) {
+    out += HEX[byte >> 4];
+    out += HEX[byte & 0xF];
+  };
+
+  // The count covers the address, data and checksum bytes
+  const auto count = static_cast<uint8_t>(len + 3);
+  uint8_t sum = count + (address >> 8) + (address & 0xFF);
+  out += 'S';
+  out += type;
+  appendByte(count);
+  appendByte(address >> 8);
+  appendByte(address & 0xFF);
+  for (size_t i = 0; i < len; i++) {
+    appendByte(data[i]);
+    sum += data[i];
+  }
+  appendByte(~sum);
+  out += '\n';
+}
+
+int HexDigit(const char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+    return (c | 0x20) - 'a' + 10;
+  }
+  return -1;
+}
+
+// Decode pairs of hex digits; false if any character is not a hex digit
+bool DecodeHex(const std::string_view text, std::vector<uint8_t>& bytes) {
+  bytes.clear();
+  for (size_t i = 0; i + 1 < text.size(); i += 2) {
+    const int high = HexDigit(text[i]);
+    const int low = HexDigit(text[i + 1]);
+    if (high < 0 || low < 0) {
+      return false;
+    }
+    bytes.push_back(high << 4 | low);
+  }
+  return text.size() % 2 == 0;
+}
+
+uint64_t EndOf(const MemorySegment& segment) {
+  return uint64_t{segment.address} + segment.data.size();
+}
+
+// Next non-blank line starting at start, without its line ending
+bool NextLine(const std::string_view text, size_t& start,
+              std::string_view& line) {
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    line = text.substr(start, end - start);
+    start = end + 1;
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+      line.remove_suffix(1);
+    }
+    if (!line.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Append a record's data, extending the previous segment if it continues it
+void AppendData(std::vector<MemorySegment>& loaded, const uint32_t address,
+                const uint8_t* first, const uint8_t* last) {
+  if (first == last) {
+    return;
+  }
+  if (!loaded.empty() && EndOf(loaded.back()) == address) {
+    loaded.back().data.insert(loaded.back().data.end(), first, last);
+  } else {
+    loaded.push_back({address, std::vector<uint8_t>(first, last)});
+  }
+}
+
+// Out-of-order records become separate segments; lay out the regions they
+// cover in address order, then copy the records in file order so a record
+// that writes an address again (as in a hand-patched file) overwrites it
+void MergeSegments(const std::vector<MemorySegment>& loaded,
+                   std::vector<MemorySegment>& segments) {
+  std::vector<size_t> order(loaded.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&loaded](const size_t a, const size_t b) {
+                     return loaded[a].address < loaded[b].address;
+                   });
+  std::vector<MemorySegment> merged;
+  for (const size_t i : order) {
+    const MemorySegment& segment = loaded[i];
+    if (!merged.empty() && EndOf(merged.back()) >= segment.address) {
+      const uint64_t end = std::max(EndOf(merged.back()), EndOf(segment));
+      merged.back().data.resize(end - merged.back().address);
+    } else {
+      merged.push_back(
+          {segment.address, std::vector<uint8_t>(segment.data.size())});
+    }
+  }
+  for (const MemorySegment& segment : loaded) {
+    MemorySegment& target = merged[FindSegment(merged, segment.address)];
+    std::copy(segment.data.begin(), segment.data.end(),
+              target.data.begin() + (segment.address - target.address));
+  }
+  segments.insert(segments.end(), std::make_move_iterator(merged.begin()),
+                  std::make_move_iterator(merged.end()));
+}
+
+// Address width in bytes of the data (S1-S3) and entry point (S7-S9) record
+// types, 0 for the others
+size_t AddressBytes(const char type) {
+  switch (type) {
+    case '1':
+    case '9':
+      return 2;
+    case '2':
+    case '8':
+      return 3;
+    case '3':
+    case '7':
+      return 4;
+    default:
+      return 0;
+  }
+}
+}  // namespace
+
+/**
+ * ToSRecords - Format an image as Motorola S-records: an S0 header, S1 data
+ * records and an S9 record whose entry point is the load address
+ * @param image - bytes to encode, at most 0x10000 - base long
+ * @param base  - load address of image[0]
+ * @return S-record text, one record per line
+ */
+std::string ToSRecords(const std::vector<uint8_t>& image, const uint16_t base) {
+  static constexpr uint8_t HEADER[] = {'h', 'c', 's', '0', '8'};
+  std::string out;
+  out.reserve((image.size() / SRECORD_DATA_BYTES + 3) *
+              (SRECORD_DATA_BYTES * 2 + 12));
+  AppendRecord(out, '0', 0, HEADER, sizeof(HEADER));
+  for (size_t offset = 0; offset < image.size(); offset += SRECORD_DATA_BYTES) {
+    AppendRecord(out, '1', base + offset, image.data() + offset,
+                 std::min(SRECORD_DATA_BYTES, image.size() - offset));
+  }
+  AppendRecord(out, '9', base, nullptr, 0);
+  return out;
+}
+
+/**
+ * ParseSRecords - Load the data records (S1, S2 and S3) of a Motorola
+ * S-record file in a single pass. Header and count records are checked but
+ * otherwise ignored. Records that continue the previous one are merged, so a
+ * typical file yields one segment per contiguous region; where records
+ * overlap, the one later in the file wins.
+ * @param text     - S-record file contents; blank lines and CR/LF are allowed
+ * @param segments - loaded segments are appended, sorted by address
+ * @param entry    - if not null, set to the address of the S7/S8/S9 record
+ * when the file has one
+ * @return false on a malformed record or checksum mismatch
+ */
+bool ParseSRecords(const std::string_view text,
+                   std::vector<MemorySegment>& segments, uint32_t* entry) {
+  std::vector<MemorySegment> loaded;
+  std::vector<uint8_t> bytes;
+  size_t start = 0;
+  std::string_view line;
+  while (NextLine(text, start, line)) {
+    // "S", type, then count, address, data and checksum as hex byte pairs
+    if (line.size() < 4 || line[0] != 'S' ||
+        !DecodeHex(line.substr(2), bytes) ||
+        bytes.size() != static_cast<size_t>(bytes[0]) + 1) {
+      return false;
+    }
+    uint8_t sum = 0;
+    for (const uint8_t byte : bytes) {
+      sum += byte;
+    }
+    if (sum != 0xFF) {
+      return false;
+    }
+
+    const size_t addressBytes = AddressBytes(line[1]);
+    if (addressBytes == 0) {
+      continue;
+    }
+    if (bytes.size() < addressBytes + 2) {
+      return false;
+    }
+    uint32_t address = 0;
+    for (size_t i = 1; i <= addressBytes; i++) {
+      address = address << 8 | bytes[i];
+    }
+    if (line[1] >= '7') {
+      if (entry != nullptr) {
+        *entry = address;
+      }
+      continue;
+    }
+    AppendData(loaded, address, bytes.data() + 1 + addressBytes,
+               bytes.data() + bytes.size() - 1);
+  }
+  MergeSegments(loaded, segments);
+  return true;
+}
+
+/**
+ * ParseIntelHex - Load the data records of an Intel HEX file in a single
+ * pass, applying extended segment (02) and extended linear (04) address
+ * records. Contiguous and overlapping records are merged as in ParseSRecords.
+ * @param text     - Intel HEX file contents; blank lines and CR/LF are allowed
+ * @param segments - loaded segments are appended, sorted by address
+ * @param entry    - if not null, set to the address of a start segment (03)
+ * or start linear (05) address record when the file has one
+ * @return false on a malformed record or checksum mismatch
+ */
+bool ParseIntelHex(const std::string_view text,
+                   std::vector<MemorySegment>& segments, uint32_t* entry) {
+  std::vector<MemorySegment> loaded;
+  std::vector<uint8_t> bytes;
+  uint32_t upper = 0;  // added to the 16-bit address of each data record
+  size_t start = 0;
+  std::string_view line;
+  while (NextLine(text, start, line)) {
+    // ":", then count, 16-bit address, type, data and checksum as hex pairs
+    if (line[0] != ':' || !DecodeHex(line.substr(1), bytes) ||
+        bytes.size() < 5 ||
+        bytes.size() != static_cast<size_t>(bytes[0]) + 5) {
+      return false;
+    }
+    uint8_t sum = 0;
+    for (const uint8_t byte : bytes) {
+      sum += byte;
+    }
+    if (sum != 0) {
+      return false;
+    }
+
+    const uint8_t* data = bytes.data() + 4;
+    const size_t count = bytes[0];
+    switch (bytes[3]) {
+      case 0x00:
+        AppendData(loaded, upper + (bytes[1] << 8 | bytes[2]), data,
+                   data + count);
+        break;
+      case 0x01:
+        MergeSegments(loaded, segments);
+        return true;
+      case 0x02:
+        if (count != 2) {
+          return false;
+        }
+        upper = (data[0] << 8 | data[1]) << 4;
+        break;
+      case 0x03:
+        if (count != 4) {
+          return false;
+        }
+        if (entry != nullptr) {
+          *entry = ((data[0] << 8 | data[1]) << 4) + (data[2] << 8 | data[3]);
+        }
+        break;
+      case 0x04:
+        if (count != 2) {
+          return false;
+        }
+        upper = static_cast<uint32_t>(data[0] << 8 | data[1]) << 16;
+        break;
+      case 0x05:
+        if (count != 4) {
+          return false;
+        }
+        if (entry != nullptr) {
+          *entry = static_cast<uint32_t>(data[0]) << 24 | data[1] << 16 |
+                   data[2] << 8 | data[3];
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+  // Tolerate a missing end-of-file record
+  MergeSegments(loaded, segments);
+  return true;
+}
+
+/**
+ * LooksLikeSRecords - Guess whether a file holds S-records rather than a flat
+ * binary from its first record type
+ * @param text - file contents
+ * @return true if the contents start with "S" and a record type digit
+ */
+bool LooksLikeSRecords(const std::string_view text) {
+  return text.size() >= 2 && text[0] == 'S' && text[1] >= '0' &&
+         text[1] <= '9';
+}
+
+/**
+ * LooksLikeIntelHex - Guess whether a file holds Intel HEX records
+ * @param text - file contents
+ * @return true if the contents start with ":" and a hex digit
+ */
+bool LooksLikeIntelHex(const std::string_view text) {
+  return text.size() >= 2 && text[0] == ':' && HexDigit(text[1]) >= 0;
+}
+
+/**
+ * FindSegment - Look up the segment holding an address
+ * @param segments - segments sorted by address
+ * @param addr     - address to look up
+ * @return index of the segment, or NO_SEGMENT if addr is not loaded
+ */
+size_t FindSegment(const std::vector<MemorySegment>& segments,
+                   const uint64_t addr) {
+  const auto next = std::upper_bound(
+      segments.begin(), segments.end(), addr,
+      [](const uint64_t a, const MemorySegment& s) { return a < s.address; });
+  if (next == segments.begin() ||
+      addr - (next - 1)->address >= (next - 1)->data.size()) {
+    return NO_SEGMENT;
+  }
+  return static_cast<size_t>(next - 1 - segments.begin());
+}
+
+/**
+ * FindEntryPoint - Pick where execution starts in a loaded image: the target
+ * of the reset vector when both are loaded, else the entry point declared by
+ * the file when it is loaded, else the start of the first segment
+ * @param segments - non-empty list of segments sorted by address
+ * @param declared - entry point record of the file, or null if it has none
+ * @return entry point address
+ */
+uint64_t FindEntryPoint(const std::vector<MemorySegment>& segments,
+                        const uint32_t* declared) {
+  const size_t high = FindSegment(segments, RESET_VECTOR);
+  const size_t low = FindSegment(segments, RESET_VECTOR + 1);
+  if (high != NO_SEGMENT && low != NO_SEGMENT) {
+    const uint64_t reset =
+        segments[high].data[RESET_VECTOR - segments[high].address] << 8 |
+        segments[low].data[RESET_VECTOR + 1 - segments[low].address];
+    if (FindSegment(segments, reset) != NO_SEGMENT) {
+      return reset;
+    }
+  }
+  if (declared != nullptr && FindSegment(segments, *declared) != NO_SEGMENT) {
+    return *declared;
+  }
+  return segments.front().address;
+}
+}  // namespace HCS08
@@ -0,0 +1,37 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_SRECORD_H
+#define HCS08_SRECORD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace HCS08 {
+// Contiguous run of bytes loaded at address
+struct MemorySegment {
+  uint32_t address = 0;
+  std::vector<uint8_t> data;
+};
+
+// Reset vector of the HCS08 vector table
+constexpr uint32_t RESET_VECTOR = 0xFFFE;
+
+constexpr size_t NO_SEGMENT = SIZE_MAX;
+
+std::string ToSRecords(const std::vector<uint8_t>& image, uint16_t base);
+bool ParseSRecords(std::string_view text, std::vector<MemorySegment>& segments,
+                   uint32_t* entry = nullptr);
+bool ParseIntelHex(std::string_view text, std::vector<MemorySegment>& segments,
+                   uint32_t* entry = nullptr);
+bool LooksLikeSRecords(std::string_view text);
+bool LooksLikeIntelHex(std::string_view text);
+size_t FindSegment(const std::vector<MemorySegment>& segments, uint64_t addr);
+uint64_t FindEntryPoint(const std::vector<MemorySegment>& segments,
+                        const uint32_t* declared = nullptr);
+}  // namespace HCS08
+
+#endif  // HCS08_SRECORD_H
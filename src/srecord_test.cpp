@@ -0,0 +1,145 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "srecord.h"
+#include "vectors.h"
+
+// Test that Intel HEX records merge into segments at their linear addresses
+// and that the entry point comes from the reset vector before the file's own
+TEST(TestRecords, TestIntelHex) {
+  std::vector<HCS08::MemorySegment> segments;
+  uint32_t entry = 0;
+
+  ASSERT_TRUE(HCS08::ParseIntelHex(
+      ":028000009D8160\r\n:0280020020FE5E\r\n:020000040001F9\r\n"
+      ":01000000A659\r\n:040000050000800077\r\n:00000001FF\r\n",
+      segments, &entry));
+  ASSERT_EQ(segments.size(), 2);
+  EXPECT_EQ(segments[0].address, 0x8000);
+  EXPECT_EQ(segments[0].data, std::vector<uint8_t>({0x9D, 0x81, 0x20, 0xFE}));
+  EXPECT_EQ(segments[1].address, 0x10000);
+  EXPECT_EQ(segments[1].data, std::vector<uint8_t>({0xA6}));
+  EXPECT_EQ(entry, 0x8000);
+  EXPECT_EQ(HCS08::FindEntryPoint(segments, &entry), 0x8000);
+
+  segments.insert(segments.begin() + 1, {HCS08::RESET_VECTOR, {0x80, 0x02}});
+  EXPECT_EQ(HCS08::FindEntryPoint(segments, &entry), 0x8002);
+
+  // Checksum mismatch
+  EXPECT_FALSE(HCS08::ParseIntelHex(":028000009D8161\n", segments));
+}
+
+// Test that an Intel HEX record writing loaded addresses again overwrites
+// them, whether it lands inside or in front of the earlier record
+TEST(TestRecords, TestIntelHexOverlap) {
+  std::vector<HCS08::MemorySegment> segments;
+  ASSERT_TRUE(HCS08::ParseIntelHex(
+      ":048000009D8120FE40\n:02800100A64295\n:0380100001020367\n"
+      ":02800F00040566\n:00000001FF\n",
+      segments));
+  ASSERT_EQ(segments.size(), 2);
+  EXPECT_EQ(segments[0].address, 0x8000);
+  EXPECT_EQ(segments[0].data, std::vector<uint8_t>({0x9D, 0xA6, 0x42, 0xFE}));
+  EXPECT_EQ(segments[1].address, 0x800F);
+  EXPECT_EQ(segments[1].data, std::vector<uint8_t>({0x04, 0x05, 0x02, 0x03}));
+}
+
+// Test that the S9 record supplies the entry point
+TEST(TestRecords, TestSRecordEntry) {
+  std::vector<HCS08::MemorySegment> segments;
+  uint32_t entry = 0;
+
+  ASSERT_TRUE(HCS08::ParseSRecords(HCS08::ToSRecords({0x9D, 0x81}, 0x8000),
+                                   segments, &entry));
+  EXPECT_EQ(entry, 0x8000);
+  EXPECT_EQ(HCS08::FindSegment(segments, 0x8001), 0);
+  EXPECT_EQ(HCS08::FindSegment(segments, 0x8002), HCS08::NO_SEGMENT);
+}
+
+// Test that S-records writing loaded addresses again overwrite them, as in
+// TestIntelHexOverlap
+TEST(TestRecords, TestSRecordOverlap) {
+  std::vector<HCS08::MemorySegment> segments;
+  ASSERT_TRUE(HCS08::ParseSRecords(
+      HCS08::ToSRecords({0x9D, 0x81, 0x20, 0xFE}, 0x8000) +
+          HCS08::ToSRecords({0xA6, 0x42}, 0x8001) +
+          HCS08::ToSRecords({0x01, 0x02, 0x03}, 0x8010) +
+          HCS08::ToSRecords({0x04, 0x05}, 0x800F),
+      segments));
+  ASSERT_EQ(segments.size(), 2);
+  EXPECT_EQ(segments[0].address, 0x8000);
+  EXPECT_EQ(segments[0].data, std::vector<uint8_t>({0x9D, 0xA6, 0x42, 0xFE}));
+  EXPECT_EQ(segments[1].address, 0x800F);
+  EXPECT_EQ(segments[1].data, std::vector<uint8_t>({0x04, 0x05, 0x02, 0x03}));
+}
+
+// Test that formatted S-records parse back into one segment, and that a bad
+// checksum is rejected
+TEST(TestRecords, TestToSRecords) {
+  // S1 data records between an S0 header and an S9 entry point record
+  EXPECT_EQ(HCS08::ToSRecords({0x9D, 0x81}, 0x8000),
+            "S0080000686373303851\nS10580009D815C\nS90380007C\n");
+
+  std::vector<uint8_t> image(100);
+  for (size_t i = 0; i < image.size(); i++) {
+    image[i] = static_cast<uint8_t>(i * 7);
+  }
+  std::vector<HCS08::MemorySegment> segments;
+  ASSERT_TRUE(
+      HCS08::ParseSRecords(HCS08::ToSRecords(image, 0x8000), segments));
+  ASSERT_EQ(segments.size(), 1);
+  EXPECT_EQ(segments[0].address, 0x8000);
+  EXPECT_EQ(segments[0].data, image);
+  EXPECT_FALSE(HCS08::ParseSRecords("S10580009D815D\n", segments));
+}
+
+// Test that programmed vectors with loaded handlers are named by number
+TEST(TestRecords, TestVectorTable) {
+  const std::vector<HCS08::MemorySegment> segments = {
+      {0x8000, {0x9D, 0x80}},
+      // Vector 3 shares the IRQ handler; SWI is erased and vector 4 points
+      // outside the image
+      {0xFFF6, {0x90, 0x00, 0x80, 0x01, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00}},
+  };
+  const std::vector<HCS08::InterruptVector> vectors =
+      HCS08::ReadVectorTable(segments);
+
+  ASSERT_EQ(vectors.size(), 3);
+  EXPECT_EQ(vectors[0].slot, HCS08::RESET_VECTOR);
+  EXPECT_EQ(vectors[0].handler, 0x8000);
+  EXPECT_EQ(vectors[0].name, "reset");
+  EXPECT_EQ(vectors[1].name, "irq_isr");
+  EXPECT_EQ(vectors[1].handler, 0x8001);
+  EXPECT_EQ(vectors[2].slot, 0xFFF8);
+  EXPECT_EQ(vectors[2].name, "vector3_isr");
+}
+
+// Test that shared handlers get one function, and every handler but reset's
+// gets the interrupt calling convention
+TEST(TestRecords, TestVectorHandlers) {
+  const std::vector<HCS08::InterruptVector> vectors = {
+      {HCS08::RESET_VECTOR, 0x8000, "reset"},
+      {0xFFFA, 0x8001, "irq_isr"},
+      {0xFFF8, 0x8001, "vector3_isr"},
+      {0xFFF6, 0x8000, "vector4_isr"},  // unused, pointed at startup code
+      {0xFFF4, 0x8002, "vector5_isr"},
+  };
+  const std::vector<HCS08::VectorHandler> handlers =
+      HCS08::CollectHandlers(vectors);
+
+  ASSERT_EQ(handlers.size(), 3);
+  EXPECT_EQ(handlers[0].address, 0x8000);
+  EXPECT_EQ(handlers[0].name, "reset");
+  EXPECT_FALSE(handlers[0].interrupt);
+  EXPECT_EQ(handlers[1].address, 0x8001);
+  EXPECT_EQ(handlers[1].name, "irq_isr");
+  EXPECT_TRUE(handlers[1].interrupt);
+  EXPECT_EQ(handlers[2].name, "vector5_isr");
+  EXPECT_TRUE(handlers[2].interrupt);
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "sweep.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "descriptors.h"
+#include "sizes.h"
+
+namespace HCS08 {
+void DecodeSink::Reserve(const size_t count) {
+  addresses.reserve(count);
+  lengths.reserve(count);
+  opcodes.reserve(count);
+  mnemonics.reserve(count);
+  branches.reserve(count);
+  targets.reserve(count);
+  operands.reserve(count);
+}
+
+void DecodeSink::Clear() {
+  addresses.clear();
+  lengths.clear();
+  opcodes.clear();
+  mnemonics.clear();
+  branches.clear();
+  targets.clear();
+  operands.clear();
+  needed = 0;
+}
+
+/**
+ * DecodeRange linearly sweeps a buffer, appending one record per instruction
+ * to sink. Undefined opcodes are recorded as 1-byte Mnemonic::INVALID entries
+ * and the sweep continues with the next byte. The sweep stops early if the
+ * buffer ends mid-instruction; sink.needed then holds the number of missing
+ * bytes.
+ * @param data - bytes to decode
+ * @param len  - number of readable bytes at data
+ * @param base - address of data[0]
+ * @param sink - caller-provided buffer the records are appended to
+ * @return number of bytes consumed
+ */
+size_t DecodeRange(const uint8_t* data, const size_t len, const uint64_t base,
+                   DecodeSink& sink) {
+  // Every instruction is at least one byte, so this bounds the record count
+  // and keeps the arrays from reallocating mid-sweep
+  sink.Reserve(sink.Size() + len);
+  sink.needed = 0;
+
+  size_t offset = 0;
+  while (offset < len) {
+    const uint8_t* bytes = data + offset;
+    const uint64_t addr = base + offset;
+
+    size_t needed;
+    const InstructionDescriptor* descriptor =
+        DecodeDescriptor(bytes, len - offset, needed);
+    if (needed > 0) {
+      sink.needed = needed;
+      break;
+    }
+
+    std::array<uint8_t, Sizes::INSTRUCTION_3_BYTES> operands{};
+    if (descriptor == nullptr) {
+      sink.addresses.push_back(addr);
+      sink.lengths.push_back(Sizes::INSTRUCTION_1_BYTE);
+      sink.opcodes.push_back(bytes[0]);
+      sink.mnemonics.push_back(Mnemonic::INVALID);
+      sink.branches.push_back(BranchKind::NONE);
+      sink.targets.push_back(DecodeSink::NO_TARGET);
+      sink.operands.push_back(operands);
+      offset += Sizes::INSTRUCTION_1_BYTE;
+      continue;
+    }
+
+    const size_t opcodeLength = GetOpcodeLength(*descriptor);
+    std::memcpy(operands.data(), bytes + opcodeLength,
+                descriptor->length - opcodeLength);
+
+    uint16_t target;
+    const bool direct = GetBranchTarget(*descriptor, bytes, addr, target);
+
+    sink.addresses.push_back(addr);
+    sink.lengths.push_back(descriptor->length);
+    sink.opcodes.push_back(descriptor->opcode);
+    sink.mnemonics.push_back(descriptor->mnemonic);
+    sink.branches.push_back(descriptor->branch);
+    sink.targets.push_back(direct ? target : DecodeSink::NO_TARGET);
+    sink.operands.push_back(operands);
+    offset += descriptor->length;
+  }
+  return offset;
+}
+}  // namespace HCS08
@@ -0,0 +1,45 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_SWEEP_H
+#define HCS08_SWEEP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "descriptors.h"
+#include "sizes.h"
+
+namespace HCS08 {
+/*
+ * Structure-of-arrays buffer filled by DecodeRange, one element per decoded
+ * instruction in every array. The buffer is owned by the caller and can be
+ * reused across ranges; Clear keeps the allocated capacity.
+ */
+struct DecodeSink {
+  static constexpr uint32_t NO_TARGET = UINT32_MAX;
+
+  std::vector<uint64_t> addresses;
+  std::vector<uint8_t> lengths;
+  std::vector<uint16_t> opcodes;    // Opcodes:: value, or the raw byte
+  std::vector<Mnemonic> mnemonics;  // Mnemonic::INVALID for undefined bytes
+  std::vector<BranchKind> branches;
+  std::vector<uint32_t> targets;  // branch destination, or NO_TARGET
+  std::vector<std::array<uint8_t, Sizes::INSTRUCTION_3_BYTES>> operands;
+
+  // Bytes still needed to complete the instruction at the end of the last
+  // range, 0 if the range ended on an instruction boundary
+  size_t needed = 0;
+
+  size_t Size() const { return addresses.size(); }
+  void Reserve(size_t count);
+  void Clear();
+};
+
+size_t DecodeRange(const uint8_t* data, size_t len, uint64_t base,
+                   DecodeSink& sink);
+}  // namespace HCS08
+
+#endif  // HCS08_SWEEP_H
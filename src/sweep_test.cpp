@@ -0,0 +1,49 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include "descriptors.h"
+#include "opcodes.h"
+#include "sweep.h"
+
+// Test that a linear sweep records every instruction and stops at a
+// truncated trailing instruction
+TEST(TestSweep, TestDecodeRange) {
+  const std::array<uint8_t, 8> image = {
+      HCS08::Opcodes::LDA_IMM,  0x42,        // lda #$42
+      HCS08::Opcodes::BRA_REL,  0xFC,        // bra back to lda
+      0x8D,                                  // undefined opcode
+      HCS08::Opcodes::JSR_EXT,  0x12, 0x34,  // jsr $1234
+  };
+  const uint64_t base = 0x1000;
+
+  HCS08::DecodeSink sink;
+  EXPECT_EQ(HCS08::DecodeRange(image.data(), image.size(), base, sink),
+            image.size());
+  ASSERT_EQ(sink.Size(), 4);
+  EXPECT_EQ(sink.needed, 0);
+
+  EXPECT_EQ(sink.opcodes[0], HCS08::Opcodes::LDA_IMM);
+  EXPECT_EQ(sink.operands[0][0], 0x42);
+  EXPECT_EQ(sink.targets[0], HCS08::DecodeSink::NO_TARGET);
+
+  EXPECT_EQ(sink.addresses[1], base + 2);
+  EXPECT_EQ(sink.branches[1], HCS08::BranchKind::JUMP);
+  EXPECT_EQ(sink.targets[1], base);
+
+  EXPECT_EQ(sink.mnemonics[2], HCS08::Mnemonic::INVALID);
+  EXPECT_EQ(sink.lengths[2], 1);
+
+  EXPECT_EQ(sink.branches[3], HCS08::BranchKind::CALL);
+  EXPECT_EQ(sink.targets[3], 0x1234);
+
+  // the same image cut off inside the JSR operand
+  sink.Clear();
+  EXPECT_EQ(HCS08::DecodeRange(image.data(), image.size() - 1, base, sink), 5);
+  EXPECT_EQ(sink.Size(), 3);
+  EXPECT_EQ(sink.needed, 1);
+}
@@ -0,0 +1,307 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "trace.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace HCS08 {
+namespace {
+/**
+ * ReadHeader - Check the header of a trace
+ * @param data  - start of the trace
+ * @param size  - bytes at data
+ * @param flags - set to the header flags
+ * @return whether the header is a known version of the format
+ */
+bool ReadHeader(const uint8_t* data, const size_t size, uint8_t& flags) {
+  if (size < TraceFormat::HEADER_SIZE ||
+      !std::equal(TraceFormat::MAGIC.begin(), TraceFormat::MAGIC.end(),
+                  data) ||
+      data[8] != TraceFormat::VERSION) {
+    return false;
+  }
+  flags = data[9];
+  return true;
+}
+}  // namespace
+
+TraceWriter::TraceWriter(std::ostream& out, const bool registers)
+    : OUT(out), REGISTERS(registers) {
+  BUFFER.reserve(BUFFER_SIZE + TraceFormat::REGISTERS_SIZE + 4);
+  BUFFER.insert(BUFFER.end(), TraceFormat::MAGIC.begin(),
+                TraceFormat::MAGIC.end());
+  BUFFER.push_back(TraceFormat::VERSION);
+  BUFFER.push_back(registers ? TraceFormat::HAS_REGISTERS : 0);
+  BUFFER.push_back(0);
+  BUFFER.push_back(0);
+}
+
+/**
+ * Step - Record one executed instruction
+ * @param pc - address of the instruction
+ */
+void TraceWriter::Step(const uint16_t pc) {
+  const int delta = static_cast<int16_t>(pc - PC);
+  if (delta >= -TraceFormat::DELTA_BIAS &&
+      delta < TraceFormat::DELTA_LIMIT - TraceFormat::DELTA_BIAS) {
+    BUFFER.push_back(static_cast<uint8_t>(delta + TraceFormat::DELTA_BIAS));
+  } else {
+    BUFFER.push_back(TraceFormat::ABSOLUTE);
+    BUFFER.push_back(pc >> 8);
+    BUFFER.push_back(pc & 0xFF);
+  }
+  PC = pc;
+  if (BUFFER.size() >= BUFFER_SIZE) {
+    Flush();
+  }
+}
+
+/**
+ * Step - Record one executed instruction and the registers it started with.
+ * The registers are dropped if the writer was created without them.
+ * @param pc        - address of the instruction
+ * @param registers - registers before the instruction ran
+ */
+void TraceWriter::Step(const uint16_t pc, const TraceRegisters& registers) {
+  if (REGISTERS) {
+    BUFFER.insert(BUFFER.end(),
+                  {TraceFormat::REGISTERS, registers.a,
+                   static_cast<uint8_t>(registers.hx >> 8),
+                   static_cast<uint8_t>(registers.hx & 0xFF),
+                   static_cast<uint8_t>(registers.sp >> 8),
+                   static_cast<uint8_t>(registers.sp & 0xFF), registers.ccr});
+  }
+  Step(pc);
+}
+
+/**
+ * Finish - Write the buffered records
+ * @return whether every record reached the stream
+ */
+bool TraceWriter::Finish() {
+  Flush();
+  OUT.flush();
+  return OUT.good();
+}
+
+void TraceWriter::Flush() {
+  OUT.write(reinterpret_cast<const char*>(BUFFER.data()),
+            static_cast<std::streamsize>(BUFFER.size()));
+  BUFFER.clear();
+}
+
+/**
+ * Open - Start reading a trace
+ * @param data - the trace, which must outlive the reader
+ * @param size - bytes at data
+ * @return whether the header is valid
+ */
+bool TraceReader::Open(const uint8_t* data, const size_t size) {
+  DATA = data;
+  SIZE = size;
+  OFFSET = TraceFormat::HEADER_SIZE;
+  PC = 0;
+  FAILED = !ReadHeader(data, size, FLAGS);
+  return !FAILED;
+}
+
+/**
+ * Next - Decode the next step
+ * @param step - set to the step, with the registers recorded before it
+ * @return false at the end of the trace or on a malformed record (see Failed)
+ */
+bool TraceReader::Next(TraceStep& step) {
+  step.hasRegisters = false;
+  while (!FAILED && OFFSET < SIZE) {
+    const uint8_t record = DATA[OFFSET++];
+    const size_t left = SIZE - OFFSET;
+    if (record < TraceFormat::DELTA_LIMIT) {
+      PC += record - TraceFormat::DELTA_BIAS;
+      step.pc = PC;
+      return true;
+    }
+    if (record == TraceFormat::ABSOLUTE && left >= 2) {
+      PC = DATA[OFFSET] << 8 | DATA[OFFSET + 1];
+      OFFSET += 2;
+      step.pc = PC;
+      return true;
+    }
+    if (record == TraceFormat::REGISTERS && HasRegisters() &&
+        left >= TraceFormat::REGISTERS_SIZE) {
+      const uint8_t* bytes = DATA + OFFSET;
+      step.hasRegisters = true;
+      step.registers.a = bytes[0];
+      step.registers.hx = bytes[1] << 8 | bytes[2];
+      step.registers.sp = bytes[3] << 8 | bytes[4];
+      step.registers.ccr = bytes[5];
+      OFFSET += TraceFormat::REGISTERS_SIZE;
+      continue;
+    }
+    FAILED = true;
+  }
+  // Registers with no step after them mean the trace was cut short
+  FAILED |= step.hasRegisters;
+  return false;
+}
+
+bool TraceReader::Failed() const { return FAILED; }
+
+bool TraceReader::HasRegisters() const {
+  return (FLAGS & TraceFormat::HAS_REGISTERS) != 0;
+}
+
+/**
+ * CountTraceHits - Add the steps of a trace to per-address counts. This is
+ * TraceReader::Next without the per-step calls, for traces of hundreds of
+ * millions of steps.
+ * @param data     - the trace
+ * @param size     - bytes at data
+ * @param coverage - counts to add to; left unchanged if the trace is
+ * malformed
+ * @return whether the whole trace was valid
+ */
+bool CountTraceHits(const uint8_t* data, const size_t size,
+                    TraceCoverage& coverage) {
+  uint8_t flags = 0;
+  if (!ReadHeader(data, size, flags)) {
+    return false;
+  }
+  const bool registers = (flags & TraceFormat::HAS_REGISTERS) != 0;
+  std::vector<uint64_t> hits(coverage.hits.size());
+  uint64_t steps = 0;
+  uint64_t snapshots = 0;
+  uint16_t pc = 0;
+  const uint8_t* next = data + TraceFormat::HEADER_SIZE;
+  const uint8_t* end = data + size;
+  while (next < end) {
+    const uint8_t record = *next++;
+    if (record < TraceFormat::DELTA_LIMIT) {
+      pc += record - TraceFormat::DELTA_BIAS;
+    } else if (record == TraceFormat::ABSOLUTE && end - next >= 2) {
+      pc = next[0] << 8 | next[1];
+      next += 2;
+    } else if (record == TraceFormat::REGISTERS && registers &&
+               // and a step must follow, as in TraceReader::Next
+               end - next > static_cast<ptrdiff_t>(
+                                TraceFormat::REGISTERS_SIZE)) {
+      next += TraceFormat::REGISTERS_SIZE;
+      snapshots++;
+      continue;
+    } else {
+      return false;
+    }
+    hits[pc]++;
+    steps++;
+  }
+
+  for (size_t i = 0; i < hits.size(); i++) {
+    coverage.hits[i] += hits[i];
+  }
+  coverage.steps += steps;
+  coverage.snapshots += snapshots;
+  return true;
+}
+
+MappedFile::~MappedFile() { Close(); }
+
+/**
+ * Open - Map a whole file read-only, replacing any file mapped before
+ * @param path - file to map
+ * @return whether the file could be opened and mapped
+ */
+bool MappedFile::Open(const std::string& path) {
+  Close();
+#ifdef _WIN32
+  FILE_HANDLE = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (FILE_HANDLE == INVALID_HANDLE_VALUE) {
+    FILE_HANDLE = nullptr;
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(FILE_HANDLE, &size)) {
+    Close();
+    return false;
+  }
+  if (size.QuadPart == 0) {
+    return true;
+  }
+  MAPPING =
+      CreateFileMappingA(FILE_HANDLE, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void* view = MAPPING == nullptr
+                         ? nullptr
+                         : MapViewOfFile(MAPPING, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    Close();
+    return false;
+  }
+  DATA = static_cast<const uint8_t*>(view);
+  SIZE = static_cast<size_t>(size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info{};
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    return false;
+  }
+  if (info.st_size > 0) {
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+                      MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED) {
+      close(fd);
+      return false;
+    }
+    madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+    DATA = static_cast<const uint8_t*>(view);
+    SIZE = static_cast<size_t>(info.st_size);
+  }
+  close(fd);  // the mapping keeps the file open
+#endif
+  return true;
+}
+
+const uint8_t* MappedFile::Data() const { return DATA; }
+
+size_t MappedFile::Size() const { return SIZE; }
+
+void MappedFile::Close() {
+#ifdef _WIN32
+  if (DATA != nullptr) {
+    UnmapViewOfFile(DATA);
+  }
+  if (MAPPING != nullptr) {
+    CloseHandle(MAPPING);
+  }
+  if (FILE_HANDLE != nullptr) {
+    CloseHandle(FILE_HANDLE);
+  }
+  FILE_HANDLE = nullptr;
+  MAPPING = nullptr;
+#else
+  if (DATA != nullptr) {
+    munmap(const_cast<uint8_t*>(DATA), SIZE);
+  }
+#endif
+  DATA = nullptr;
+  SIZE = 0;
+}
+}  // namespace HCS08
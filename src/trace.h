@@ -0,0 +1,133 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_TRACE_H
+#define HCS08_TRACE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+ * Execution trace file: a 12-byte header, then one record per executed
+ * instruction ("step"). Each PC is stored as the difference from the one
+ * before it, so sequential code and short loops take one byte per step.
+ *
+ *   header    "HCS08TRC", version, header flags, two zero bytes
+ *   $00-$EF   step to the previous PC + (byte - DELTA_BIAS)
+ *   $F0 hi lo step to the absolute PC hi:lo
+ *   $F1 a h x sph spl ccr
+ *             registers before the next step (only with HAS_REGISTERS)
+ *
+ * The previous PC starts at 0 and arithmetic wraps at 16 bits. Bytes $F2-$FF
+ * are reserved.
+ */
+namespace HCS08::TraceFormat {
+constexpr std::array<char, 8> MAGIC = {'H', 'C', 'S', '0', '8', 'T', 'R', 'C'};
+constexpr uint8_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 12;
+constexpr uint8_t HAS_REGISTERS = 1 << 0;  // header flag
+
+constexpr uint8_t DELTA_LIMIT = 0xF0;  // bytes below this are deltas
+constexpr int DELTA_BIAS = 0x70;       // deltas span -$70 to +$7F
+constexpr uint8_t ABSOLUTE = 0xF0;
+constexpr uint8_t REGISTERS = 0xF1;
+constexpr size_t REGISTERS_SIZE = 6;
+}  // namespace HCS08::TraceFormat
+
+namespace HCS08 {
+// CPU registers recorded alongside a step; the PC is the step's own
+struct TraceRegisters {
+  uint8_t a = 0;
+  uint16_t hx = 0;
+  uint16_t sp = 0;
+  uint8_t ccr = 0;
+};
+
+struct TraceStep {
+  uint16_t pc = 0;
+  bool hasRegisters = false;  // registers holds a snapshot for this step
+  TraceRegisters registers;
+};
+
+/*
+ * Appends steps to a trace file. Records are collected in a buffer and written
+ * in large blocks; call Finish to write the rest and check the stream.
+ */
+class TraceWriter {
+ public:
+  TraceWriter(std::ostream& out, bool registers);
+
+  void Step(uint16_t pc);
+  void Step(uint16_t pc, const TraceRegisters& registers);
+  bool Finish();
+
+ private:
+  static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+  void Flush();
+
+  std::ostream& OUT;
+  std::vector<uint8_t> BUFFER;
+  uint16_t PC = 0;
+  bool REGISTERS;
+};
+
+// Decodes the steps of a trace held in memory, one at a time
+class TraceReader {
+ public:
+  bool Open(const uint8_t* data, size_t size);
+  bool Next(TraceStep& step);
+  bool Failed() const;
+  bool HasRegisters() const;
+
+ private:
+  const uint8_t* DATA = nullptr;
+  size_t SIZE = 0;
+  size_t OFFSET = 0;
+  uint16_t PC = 0;
+  uint8_t FLAGS = 0;
+  bool FAILED = false;
+};
+
+// Per-address step counts of a whole trace
+struct TraceCoverage {
+  std::vector<uint64_t> hits = std::vector<uint64_t>(0x10000);
+  uint64_t steps = 0;
+  uint64_t snapshots = 0;  // register records
+};
+
+bool CountTraceHits(const uint8_t* data, size_t size,
+                    TraceCoverage& coverage);
+
+/*
+ * A file mapped read-only into memory, so traces of hundreds of millions of
+ * steps are decoded straight from the page cache without being copied.
+ */
+class MappedFile {
+ public:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  bool Open(const std::string& path);
+  const uint8_t* Data() const;
+  size_t Size() const;
+
+ private:
+  void Close();
+
+  const uint8_t* DATA = nullptr;
+  size_t SIZE = 0;
+#ifdef _WIN32
+  void* FILE_HANDLE = nullptr;
+  void* MAPPING = nullptr;
+#endif
+};
+}  // namespace HCS08
+
+#endif  // HCS08_TRACE_H
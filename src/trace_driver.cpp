@@ -0,0 +1,210 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "trace.h"
+
+namespace {
+constexpr const char* USAGE =
+    "usage: hcs08-trace pack [--registers] TEXT TRACE\n"
+    "       hcs08-trace stats [--top N] TRACE\n"
+    "  pack   convert a text trace, one step per line as hex \"PC\" or\n"
+    "         \"PC A HX SP CCR\", to the binary trace format\n"
+    "  stats  print step counts and the most executed addresses\n"
+    "  --registers  keep the registers of lines that have them\n"
+    "  --top N      addresses to list (default 10)\n";
+
+int Fail(const std::string& message) {
+  std::cerr << "hcs08-trace: " << message << "\n" << USAGE;
+  return 1;
+}
+
+/**
+ * NextField - Parse the next whitespace-separated hex field of a line
+ * @param line  - rest of the line; emptied at its end or at a # comment
+ * @param value - set to the field
+ * @return false at the end of the line, or on a malformed field (line is then
+ * left non-empty)
+ */
+template <typename T>
+bool NextField(std::string_view& line, T& value) {
+  const size_t start = line.find_first_not_of(" \t\r");
+  if (start == std::string_view::npos || line[start] == '#') {
+    line = {};
+    return false;
+  }
+  line.remove_prefix(start);
+  std::string_view digits = line;
+  if (digits.starts_with("0x") || digits.starts_with("0X")) {
+    digits.remove_prefix(2);
+  }
+  const char* end = digits.data() + digits.size();
+  const auto [ptr, error] = std::from_chars(digits.data(), end, value, 16);
+  if (error != std::errc() ||
+      (ptr != end && std::string_view(" \t\r#").find(*ptr) ==
+                         std::string_view::npos)) {
+    return false;
+  }
+  line.remove_prefix(ptr - line.data());
+  return true;
+}
+
+/**
+ * Pack - Convert a text trace to the binary format
+ * @param input     - text, one step per line
+ * @param output    - trace file to write
+ * @param registers - record the registers of lines that have them
+ * @return exit status
+ */
+int Pack(const char* input, const char* output, const bool registers) {
+  HCS08::MappedFile text;
+  if (!text.Open(input)) {
+    return Fail("cannot read " + std::string(input));
+  }
+  std::ofstream out(output, std::ios::binary);
+  if (!out) {
+    return Fail("cannot write " + std::string(output));
+  }
+  HCS08::TraceWriter writer(out, registers);
+  const std::string_view contents(reinterpret_cast<const char*>(text.Data()),
+                                  text.Size());
+  uint64_t steps = 0;
+  size_t lineNumber = 0;
+  const auto malformed = [&](const char* expected) {
+    return Fail(std::string(input) + ":" + std::to_string(lineNumber) +
+                ": expected " + expected);
+  };
+  for (size_t start = 0; start < contents.size();) {
+    const size_t newline = std::min(contents.find('\n', start),
+                                    contents.size());
+    std::string_view line = contents.substr(start, newline - start);
+    start = newline + 1;
+    lineNumber++;
+
+    uint16_t pc = 0;
+    if (!NextField(line, pc)) {
+      if (!line.empty()) {
+        return malformed("a hex PC");
+      }
+      continue;  // blank or comment
+    }
+    HCS08::TraceRegisters state;
+    if (NextField(line, state.a)) {
+      if (!NextField(line, state.hx) || !NextField(line, state.sp) ||
+          !NextField(line, state.ccr)) {
+        return malformed("hex A HX SP CCR after the PC");
+      }
+      writer.Step(pc, state);
+    } else if (line.empty()) {
+      writer.Step(pc);
+    } else {
+      return malformed("hex A HX SP CCR after the PC");
+    }
+    steps++;
+  }
+  if (!writer.Finish()) {
+    return Fail("error writing " + std::string(output));
+  }
+  std::fprintf(stderr, "%llu steps\n", static_cast<unsigned long long>(steps));
+  return 0;
+}
+
+/**
+ * Stats - Print the step counts of a trace and its most executed addresses
+ * @param path - trace file
+ * @param top  - addresses to list
+ * @return exit status
+ */
+int Stats(const char* path, const size_t top) {
+  HCS08::MappedFile file;
+  if (!file.Open(path)) {
+    return Fail("cannot read " + std::string(path));
+  }
+  HCS08::TraceCoverage coverage;
+  const auto start = std::chrono::steady_clock::now();
+  if (!HCS08::CountTraceHits(file.Data(), file.Size(), coverage)) {
+    return Fail(std::string(path) + " is not a valid HCS08 trace");
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::vector<std::pair<uint64_t, uint16_t>> hot;
+  for (size_t addr = 0; addr < coverage.hits.size(); addr++) {
+    if (coverage.hits[addr] != 0) {
+      hot.emplace_back(coverage.hits[addr], static_cast<uint16_t>(addr));
+    }
+  }
+  std::printf("steps\t%llu\nsnapshots\t%llu\naddresses\t%zu\nbytes\t%zu\n",
+              static_cast<unsigned long long>(coverage.steps),
+              static_cast<unsigned long long>(coverage.snapshots), hot.size(),
+              file.Size());
+  const size_t listed = std::min(top, hot.size());
+  std::partial_sort(hot.begin(), hot.begin() + listed, hot.end(),
+                    [](const auto& a, const auto& b) {
+                      return a.first > b.first ||
+                             (a.first == b.first && a.second < b.second);
+                    });
+  for (size_t i = 0; i < listed; i++) {
+    std::printf("%04X\t%llu\n", hot[i].second,
+                static_cast<unsigned long long>(hot[i].first));
+  }
+  std::fprintf(stderr, "decoded in %.3f s (%.0f M steps/s)\n",
+               elapsed.count(), coverage.steps / elapsed.count() / 1e6);
+  return 0;
+}
+}  // namespace
+
+/*
+ * Converts text traces from debug tools to the binary trace format that the
+ * plugin's "Import Execution Trace" command reads, and summarizes traces.
+ */
+int main(const int argc, char** argv) {
+  if (argc < 2) {
+    return Fail("no command");
+  }
+  const std::string_view command = argv[1];
+  bool registers = false;
+  size_t top = 10;
+  std::vector<const char*> paths;
+  for (int i = 2; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg == "--registers") {
+      registers = true;
+    } else if (arg == "--top") {
+      if (i + 1 >= argc) {
+        return Fail("missing value for --top");
+      }
+      const std::string_view value = argv[++i];
+      const auto [ptr, error] =
+          std::from_chars(value.data(), value.data() + value.size(), top);
+      if (error != std::errc() || ptr != value.data() + value.size()) {
+        return Fail("invalid value for --top: " + std::string(value));
+      }
+    } else if (arg.starts_with("--")) {
+      return Fail("unexpected argument " + std::string(arg));
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  if (command == "pack" && paths.size() == 2) {
+    return Pack(paths[0], paths[1], registers);
+  }
+  if (command == "stats" && paths.size() == 1) {
+    return Stats(paths[0], top);
+  }
+  return Fail("unexpected arguments for " + std::string(command));
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "coverage.h"
+#include "trace.h"
+
+namespace {
+const uint8_t* Bytes(const std::string& text) {
+  return reinterpret_cast<const uint8_t*>(text.data());
+}
+}  // namespace
+
+// Test that steps and snapshots read back as written, with near PCs packed
+// into one byte and far ones stored whole
+TEST(TestTrace, TestRoundTrip) {
+  const std::vector<uint16_t> pcs = {0x0010, 0x0012, 0x0013, 0x0005, 0x8000,
+                                     0x807F, 0x8010, 0xFFFE, 0x0002};
+  std::ostringstream out;
+  HCS08::TraceWriter writer(out, true);
+  for (const uint16_t pc : pcs) {
+    if (pc == 0x8000) {
+      writer.Step(pc, {0x12, 0x3456, 0x00FF, 0x68});
+    } else {
+      writer.Step(pc);
+    }
+  }
+  ASSERT_TRUE(writer.Finish());
+  const std::string trace = out.str();
+  // Only $8000 (after $0005) and $FFFE (after $8010) are out of delta range
+  EXPECT_EQ(trace.size(), HCS08::TraceFormat::HEADER_SIZE + pcs.size() +
+                              2 * 2 + 1 + HCS08::TraceFormat::REGISTERS_SIZE);
+
+  HCS08::TraceReader reader;
+  ASSERT_TRUE(reader.Open(Bytes(trace), trace.size()));
+  EXPECT_TRUE(reader.HasRegisters());
+  HCS08::TraceStep step;
+  for (const uint16_t pc : pcs) {
+    ASSERT_TRUE(reader.Next(step));
+    EXPECT_EQ(step.pc, pc);
+    EXPECT_EQ(step.hasRegisters, pc == 0x8000);
+  }
+  EXPECT_FALSE(reader.Next(step));
+  EXPECT_FALSE(reader.Failed());
+
+  HCS08::TraceCoverage coverage;
+  ASSERT_TRUE(HCS08::CountTraceHits(Bytes(trace), trace.size(), coverage));
+  ASSERT_TRUE(HCS08::CountTraceHits(Bytes(trace), trace.size(), coverage));
+  EXPECT_EQ(coverage.steps, 2 * pcs.size());
+  EXPECT_EQ(coverage.snapshots, 2);
+  EXPECT_EQ(coverage.hits[0x8000], 2);
+  EXPECT_EQ(coverage.hits[0x8001], 0);
+}
+
+// Test that truncated and corrupt traces are rejected without counting
+TEST(TestTrace, TestMalformed) {
+  std::ostringstream out;
+  HCS08::TraceWriter writer(out, false);
+  writer.Step(0x9000);
+  writer.Step(0x9002, {});  // registers dropped without HAS_REGISTERS
+  ASSERT_TRUE(writer.Finish());
+  const std::string trace = out.str();
+  EXPECT_EQ(trace.size(), HCS08::TraceFormat::HEADER_SIZE + 3 + 1);
+
+  HCS08::TraceCoverage coverage;
+  EXPECT_FALSE(HCS08::CountTraceHits(Bytes(trace), trace.size() - 2,
+                                     coverage));  // cut inside $F0 hi lo
+  std::string corrupt = trace;
+  corrupt.back() = static_cast<char>(HCS08::TraceFormat::REGISTERS);
+  EXPECT_FALSE(HCS08::CountTraceHits(Bytes(corrupt), corrupt.size(),
+                                     coverage));
+  corrupt[8] = 2;  // version
+  EXPECT_FALSE(HCS08::CountTraceHits(Bytes(corrupt), corrupt.size(),
+                                     coverage));
+  EXPECT_EQ(coverage.steps, 0);
+  EXPECT_EQ(coverage.hits[0x9000], 0);
+
+  HCS08::TraceReader reader;
+  HCS08::TraceStep step;
+  ASSERT_TRUE(reader.Open(Bytes(trace), trace.size() - 1));
+  EXPECT_TRUE(reader.Next(step));
+  EXPECT_FALSE(reader.Next(step));
+  EXPECT_FALSE(reader.Failed());
+  ASSERT_TRUE(reader.Open(Bytes(trace), trace.size() - 2));
+  EXPECT_FALSE(reader.Next(step));
+  EXPECT_TRUE(reader.Failed());
+}
+
+// Test summing per-address hits over overlapping intervals
+TEST(TestTrace, TestIntervalHits) {
+  const HCS08::IntervalIndex index({{0x8010, 0x8020, 0},
+                                    {0x8000, 0x8040, 1},
+                                    {0x8018, 0x8019, 2},
+                                    {0x8040, 0x8050, 3}});
+  HCS08::TraceCoverage coverage;
+  coverage.hits[0x7FFF] = 7;
+  coverage.hits[0x8000] = 1;
+  coverage.hits[0x8018] = 10;
+  coverage.hits[0x8030] = 100;
+  coverage.hits[0x8040] = 1000;
+  coverage.hits[0x8050] = 5;
+
+  HCS08::IntervalHits result;
+  HCS08::SumIntervalHits(index, 4, coverage, result);
+  EXPECT_EQ(result.hits, std::vector<uint64_t>({10, 111, 10, 1000}));
+  EXPECT_EQ(result.unmapped, 12);
+  EXPECT_EQ(result.unmappedAddresses, 2);
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "triage.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "decoder.h"
+#include "descriptors.h"
+#include "srecord.h"
+#include "sweep.h"
+#include "vectors.h"
+
+namespace HCS08 {
+namespace {
+/**
+ * CountReachable - Follow control flow from the entry point and the interrupt
+ * handlers and count the bytes of every instruction visited. Indirect jumps
+ * and returns end a path; calls and conditional branches continue with the
+ * next instruction as well as the target.
+ * @param segments - loaded image, sorted by address
+ * @return number of distinct bytes covered by reachable instructions
+ */
+size_t CountReachable(const std::vector<MemorySegment>& segments) {
+  std::vector<std::vector<bool>> visited;
+  visited.reserve(segments.size());
+  for (const MemorySegment& segment : segments) {
+    visited.emplace_back(segment.data.size(), false);
+  }
+
+  size_t reachable = 0;
+  std::vector<uint64_t> pending = {FindEntryPoint(segments)};
+  for (const InterruptVector& vector : ReadVectorTable(segments)) {
+    pending.push_back(vector.handler);
+  }
+  DecodedInstruction decoded;
+  while (!pending.empty()) {
+    uint64_t addr = pending.back();
+    pending.pop_back();
+    for (;;) {
+      const size_t index = FindSegment(segments, addr);
+      if (index == NO_SEGMENT) {
+        break;
+      }
+      const MemorySegment& segment = segments[index];
+      const size_t offset = addr - segment.address;
+      size_t needed;
+      if (visited[index][offset] ||
+          !DecodeAt(segment.data.data() + offset, segment.data.size() - offset,
+                    addr, decoded, needed)) {
+        break;
+      }
+      for (size_t i = offset; i < offset + decoded.length; i++) {
+        reachable += visited[index][i] ? 0 : 1;
+        visited[index][i] = true;
+      }
+
+      bool fallsThrough = true;
+      for (size_t i = 0; i < decoded.branchCount; i++) {
+        const BranchInfo& branch = decoded.branches[i];
+        switch (branch.type) {
+          case BranchType::UNCONDITIONAL:
+            pending.push_back(branch.target);
+            fallsThrough = false;
+            break;
+          case BranchType::TRUE_BRANCH:
+          case BranchType::CALL:
+            pending.push_back(branch.target);
+            break;
+          case BranchType::FALSE_BRANCH:
+            break;
+          case BranchType::INDIRECT:
+          case BranchType::RETURN:
+            fallsThrough = false;
+            break;
+        }
+      }
+      if (!fallsThrough) {
+        break;
+      }
+      addr += decoded.length;
+    }
+  }
+  return reachable;
+}
+}  // namespace
+
+double ImageStats::InvalidRatio() const {
+  return bytes == 0 ? 0 : static_cast<double>(invalidBytes) / bytes;
+}
+
+double ImageStats::Coverage() const {
+  return bytes == 0 ? 0 : static_cast<double>(reachableBytes) / bytes;
+}
+
+/**
+ * AnalyzeImage - Collect triage statistics for one firmware image
+ * @param segments - loaded image, sorted by address as ParseSRecords returns
+ * @param sink     - scratch buffer for the sweep, reused across calls
+ * @param stats    - overwritten with the image's statistics
+ */
+void AnalyzeImage(const std::vector<MemorySegment>& segments,
+                  DecodeSink& sink, ImageStats& stats) {
+  stats = ImageStats();
+  for (const MemorySegment& segment : segments) {
+    sink.Clear();
+    const size_t consumed = DecodeRange(
+        segment.data.data(), segment.data.size(), segment.address, sink);
+    for (size_t i = 0; i < sink.Size(); i++) {
+      if (sink.mnemonics[i] == Mnemonic::INVALID) {
+        stats.invalidBytes += sink.lengths[i];
+        continue;
+      }
+      stats.instructions++;
+      if (sink.branches[i] != BranchKind::NONE) {
+        stats.branches++;
+      }
+    }
+    stats.bytes += segment.data.size();
+    stats.invalidBytes += segment.data.size() - consumed;
+  }
+  if (!segments.empty()) {
+    stats.reachableBytes = CountReachable(segments);
+  }
+}
+}  // namespace HCS08
@@ -0,0 +1,36 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_TRIAGE_H
+#define HCS08_TRIAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "srecord.h"
+#include "sweep.h"
+
+namespace HCS08 {
+/*
+ * Summary of one firmware image. The counts come from a linear sweep of every
+ * segment; reachableBytes comes from following control flow out of the entry
+ * point (see FindEntryPoint) and the interrupt handlers, and estimates how
+ * much of the image is code.
+ */
+struct ImageStats {
+  size_t bytes = 0;         // loaded bytes over all segments
+  size_t instructions = 0;  // defined instructions found by the sweep
+  size_t invalidBytes = 0;  // undefined opcodes and truncated tails
+  size_t branches = 0;      // instructions with a BranchKind other than NONE
+  size_t reachableBytes = 0;
+
+  double InvalidRatio() const;
+  double Coverage() const;
+};
+
+void AnalyzeImage(const std::vector<MemorySegment>& segments,
+                  DecodeSink& sink, ImageStats& stats);
+}  // namespace HCS08
+
+#endif  // HCS08_TRIAGE_H
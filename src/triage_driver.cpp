@@ -0,0 +1,257 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "srecord.h"
+#include "sweep.h"
+#include "triage.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* USAGE =
+    "usage: hcs08-triage [--jobs N] [--base ADDR] [--format bin|srec|ihex] "
+    "PATH...\n"
+    "  --jobs N                worker threads (default: one per core)\n"
+    "  --base ADDR             load address of flat binaries (default 0)\n"
+    "  --format bin|srec|ihex  input format (default: detected per file)\n"
+    "  PATH                    image file, or directory searched "
+    "recursively\n";
+
+/*
+ * Runs jobs 0..count-1 on a fixed set of threads. Each worker owns a deque
+ * and takes from its back; a worker whose deque is empty steals from the
+ * front of the others, so one large image does not hold up the jobs queued
+ * behind it. No jobs are added once the workers start, so a worker that finds
+ * every deque empty is done.
+ */
+class WorkStealingPool {
+ public:
+  using Job = std::function<void(size_t job, size_t worker)>;
+
+  explicit WorkStealingPool(const size_t workers) : QUEUES(workers) {}
+
+  // Jobs should be ordered most expensive first; they are dealt round-robin
+  void Run(const size_t count, const Job& job) {
+    for (size_t i = count; i-- > 0;) {
+      QUEUES[i % QUEUES.size()].jobs.push_back(i);
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(QUEUES.size());
+    for (size_t worker = 0; worker < QUEUES.size(); worker++) {
+      threads.emplace_back([this, &job, worker] {
+        size_t next;
+        while (Take(worker, next)) {
+          job(next, worker);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+ private:
+  struct Queue {
+    std::mutex lock;
+    std::deque<size_t> jobs;
+  };
+
+  bool Take(const size_t worker, size_t& job) {
+    for (size_t i = 0; i < QUEUES.size(); i++) {
+      Queue& queue = QUEUES[(worker + i) % QUEUES.size()];
+      const std::lock_guard<std::mutex> guard(queue.lock);
+      if (queue.jobs.empty()) {
+        continue;
+      }
+      if (i == 0) {
+        job = queue.jobs.back();
+        queue.jobs.pop_back();
+      } else {
+        job = queue.jobs.front();
+        queue.jobs.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  std::vector<Queue> QUEUES;
+};
+
+struct Image {
+  Image(fs::path path, const uintmax_t size)
+      : path(std::move(path)), size(size) {}
+
+  fs::path path;
+  uintmax_t size = 0;
+  bool loaded = false;
+  HCS08::ImageStats stats{};
+};
+
+// Per-thread buffers, reused for every image the thread analyzes
+struct Scratch {
+  std::string contents;
+  std::vector<HCS08::MemorySegment> segments;
+  HCS08::DecodeSink sink;
+};
+
+bool ReadFile(const fs::path& path, std::string& contents) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  contents.assign(std::istreambuf_iterator<char>(in),
+                  std::istreambuf_iterator<char>());
+  return !in.bad();
+}
+
+bool LoadImage(const fs::path& path, const std::string& format,
+               const uint32_t base, Scratch& scratch) {
+  if (!ReadFile(path, scratch.contents)) {
+    return false;
+  }
+  scratch.segments.clear();
+  if (format == "srec" ||
+      (format.empty() && HCS08::LooksLikeSRecords(scratch.contents))) {
+    return HCS08::ParseSRecords(scratch.contents, scratch.segments);
+  }
+  if (format == "ihex" ||
+      (format.empty() && HCS08::LooksLikeIntelHex(scratch.contents))) {
+    return HCS08::ParseIntelHex(scratch.contents, scratch.segments);
+  }
+  scratch.segments.push_back(
+      {base, std::vector<uint8_t>(scratch.contents.begin(),
+                                  scratch.contents.end())});
+  return true;
+}
+
+bool CollectImages(const std::string& arg, std::vector<Image>& images) {
+  std::error_code error;
+  if (!fs::is_directory(arg, error)) {
+    images.emplace_back(arg, fs::file_size(arg, error));
+    return !error;
+  }
+  for (fs::recursive_directory_iterator it(arg, error), end;
+       !error && it != end; it.increment(error)) {
+    if (it->is_regular_file(error)) {
+      images.emplace_back(it->path(), it->file_size(error));
+    }
+  }
+  return !error;
+}
+
+int Fail(const std::string& message) {
+  std::cerr << "hcs08-triage: " << message << "\n" << USAGE;
+  return 1;
+}
+}  // namespace
+
+/*
+ * Analyzes a set of firmware images in parallel without Binary Ninja and
+ * prints one tab-separated line of statistics per image, in path order.
+ */
+int main(const int argc, char** argv) {
+  size_t jobs = std::max(1u, std::thread::hardware_concurrency());
+  uint32_t base = 0;
+  std::string format;
+  std::vector<Image> images;
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with("--") && i + 1 >= argc) {
+      return Fail("missing value for " + std::string(arg));
+    }
+    if (arg == "--jobs" || arg == "--base") {
+      std::string_view value = argv[++i];
+      int radix = 10;
+      if (value.starts_with("0x") || value.starts_with("0X")) {
+        value.remove_prefix(2);
+        radix = 16;
+      }
+      const char* end = value.data() + value.size();
+      const auto [ptr, error] =
+          arg == "--jobs" ? std::from_chars(value.data(), end, jobs, radix)
+                          : std::from_chars(value.data(), end, base, radix);
+      if (error != std::errc() || ptr != end || jobs == 0) {
+        return Fail("invalid value for " + std::string(arg) + ": " + argv[i]);
+      }
+    } else if (arg == "--format") {
+      format = argv[++i];
+      if (format != "bin" && format != "srec" && format != "ihex") {
+        return Fail("unknown format " + format);
+      }
+    } else if (arg.starts_with("--")) {
+      return Fail("unexpected argument " + std::string(arg));
+    } else if (!CollectImages(argv[i], images)) {
+      return Fail("cannot read " + std::string(arg));
+    }
+  }
+  if (images.empty()) {
+    return Fail("no input images");
+  }
+
+  // Start the largest images first so the stragglers are small ones
+  std::vector<size_t> order(images.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return images[a].size > images[b].size;
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  jobs = std::min(jobs, images.size());
+  std::vector<Scratch> scratch(jobs);
+  WorkStealingPool(jobs).Run(images.size(), [&](size_t job, size_t worker) {
+    Image& image = images[order[job]];
+    image.loaded = LoadImage(image.path, format, base, scratch[worker]);
+    if (image.loaded) {
+      HCS08::AnalyzeImage(scratch[worker].segments, scratch[worker].sink,
+                          image.stats);
+    }
+  });
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::sort(images.begin(), images.end(),
+            [](const Image& a, const Image& b) { return a.path < b.path; });
+  std::printf(
+      "image\tbytes\tinstructions\tinvalid_ratio\tbranches\tcoverage\n");
+  size_t failed = 0;
+  uint64_t totalBytes = 0;
+  for (const Image& image : images) {
+    if (!image.loaded) {
+      std::cerr << "hcs08-triage: cannot load " << image.path.string() << "\n";
+      failed++;
+      continue;
+    }
+    const HCS08::ImageStats& stats = image.stats;
+    std::printf("%s\t%zu\t%zu\t%.4f\t%zu\t%.4f\n", image.path.string().c_str(),
+                stats.bytes, stats.instructions, stats.InvalidRatio(),
+                stats.branches, stats.Coverage());
+    totalBytes += stats.bytes;
+  }
+  std::fprintf(stderr, "%zu images, %.1f MiB in %.3f s on %zu threads\n",
+               images.size() - failed, totalBytes / 1048576.0,
+               elapsed.count(), jobs);
+  return failed == 0 ? 0 : 1;
+}
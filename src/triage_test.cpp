@@ -0,0 +1,34 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "opcodes.h"
+#include "srecord.h"
+#include "sweep.h"
+#include "triage.h"
+
+// Test the sweep counts and that coverage follows the reset vector
+TEST(TestTriage, TestAnalyzeImage) {
+  const std::vector<HCS08::MemorySegment> segments = {
+      // nop; bra *; an undefined byte; lda # cut off by the end of the segment
+      {0x8000,
+       {HCS08::Opcodes::NOP_INH, HCS08::Opcodes::BRA_REL, 0xFE, 0x8D,
+        HCS08::Opcodes::LDA_IMM}},
+      // Reset vector, swept as rti and a truncated brset
+      {HCS08::RESET_VECTOR, {0x80, 0x00}},
+  };
+  HCS08::DecodeSink sink;
+  HCS08::ImageStats stats;
+
+  HCS08::AnalyzeImage(segments, sink, stats);
+
+  EXPECT_EQ(stats.bytes, 7);
+  EXPECT_EQ(stats.instructions, 3);
+  EXPECT_EQ(stats.invalidBytes, 3);
+  EXPECT_EQ(stats.branches, 2);
+  EXPECT_EQ(stats.reachableBytes, 3);
+  EXPECT_DOUBLE_EQ(stats.Coverage(), 3.0 / 7);
+}
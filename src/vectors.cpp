@@ -0,0 +1,94 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "vectors.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "srecord.h"
+
+namespace HCS08 {
+/**
+ * VectorName - Name the handler of a vector table entry. Reset, SWI and IRQ
+ * sit at the same place on every HCS08; the peripheral vectors below them
+ * differ between derivatives, so they are named by vector number as in the
+ * reference manuals.
+ * @param slot - address of the vector table entry
+ * @return function name for the handler
+ */
+std::string VectorName(const uint16_t slot) {
+  const size_t number = (RESET_VECTOR - slot) / 2;
+  switch (number) {
+    case 0:
+      return "reset";
+    case 1:
+      return "swi_isr";
+    case 2:
+      return "irq_isr";
+    default:
+      return "vector" + std::to_string(number) + "_isr";
+  }
+}
+
+/**
+ * IsProgrammedVector - Check whether a vector holds a handler address
+ * @param handler - contents of the vector table entry
+ * @return false for erased flash ($FFFF) and $0000, which is a register
+ */
+bool IsProgrammedVector(const uint16_t handler) {
+  return handler != 0xFFFF && handler != 0x0000;
+}
+
+/**
+ * ReadVectorTable - Collect the programmed vectors of a loaded image whose
+ * handlers are loaded as well, reset first
+ * @param segments - loaded image, sorted by address
+ * @return one entry per usable vector
+ */
+std::vector<InterruptVector> ReadVectorTable(
+    const std::vector<MemorySegment>& segments) {
+  std::vector<InterruptVector> vectors;
+  for (uint32_t slot = RESET_VECTOR; slot >= VECTOR_TABLE_START; slot -= 2) {
+    const size_t high = FindSegment(segments, slot);
+    const size_t low = FindSegment(segments, slot + 1);
+    if (high == NO_SEGMENT || low == NO_SEGMENT) {
+      continue;
+    }
+    const auto handler = static_cast<uint16_t>(
+        segments[high].data[slot - segments[high].address] << 8 |
+        segments[low].data[slot + 1 - segments[low].address]);
+    if (IsProgrammedVector(handler) &&
+        FindSegment(segments, handler) != NO_SEGMENT) {
+      vectors.push_back({static_cast<uint16_t>(slot), handler,
+                         VectorName(static_cast<uint16_t>(slot))});
+    }
+  }
+  return vectors;
+}
+
+/**
+ * CollectHandlers - Merge the vectors that share a handler. A handler takes
+ * the name of its lowest-numbered vector, and is an interrupt handler unless
+ * that vector is reset: startup code is entered once and never returns.
+ * @param vectors - vectors from ReadVectorTable, reset first
+ * @return one entry per distinct handler, in the order of the vectors
+ */
+std::vector<VectorHandler> CollectHandlers(
+    const std::vector<InterruptVector>& vectors) {
+  std::vector<VectorHandler> handlers;
+  for (const InterruptVector& vector : vectors) {
+    if (std::none_of(handlers.begin(), handlers.end(),
+                     [&](const VectorHandler& handler) {
+                       return handler.address == vector.handler;
+                     })) {
+      handlers.push_back(
+          {vector.handler, vector.name, vector.slot != RESET_VECTOR});
+    }
+  }
+  return handlers;
+}
+}  // namespace HCS08
@@ -0,0 +1,41 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_VECTORS_H
+#define HCS08_VECTORS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "srecord.h"
+
+namespace HCS08 {
+// The vector table holds 16-bit handler addresses from $FFC0 up to the reset
+// vector at $FFFE; vector n lives at RESET_VECTOR - 2n
+constexpr uint32_t VECTOR_TABLE_START = 0xFFC0;
+constexpr size_t VECTOR_COUNT = 32;
+
+struct InterruptVector {
+  uint16_t slot;     // address of the vector table entry
+  uint16_t handler;  // address the entry points to
+  std::string name;  // function name for the handler
+};
+
+// Function for the vectors that share one handler
+struct VectorHandler {
+  uint16_t address;
+  std::string name;  // name of the lowest-numbered vector
+  bool interrupt;    // entered by an interrupt and left with RTI
+};
+
+std::string VectorName(uint16_t slot);
+bool IsProgrammedVector(uint16_t handler);
+std::vector<InterruptVector> ReadVectorTable(
+    const std::vector<MemorySegment>& segments);
+std::vector<VectorHandler> CollectHandlers(
+    const std::vector<InterruptVector>& vectors);
+}  // namespace HCS08
+
+#endif  // HCS08_VECTORS_H
@@ -0,0 +1,261 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "view.h"
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "coverage.h"
+#include "platform.h"
+#include "sizes.h"
+#include "srecord.h"
+#include "trace.h"
+#include "vectors.h"
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+namespace {
+constexpr const char* VIEW_NAME = "HCS08 Hex";
+constexpr const char* VIEW_LONG_NAME = "HCS08 S-Record / Intel HEX";
+
+// Enough of the file to recognize the first record
+constexpr size_t SNIFF_BYTES = 16;
+
+constexpr uint32_t NO_ENTRY = UINT32_MAX;
+
+/**
+ * Load - Parse the records of a raw S-record or Intel HEX view in a single
+ * pass over one buffer and build the view over the packed data
+ * @param data - raw view of the file
+ * @return the new view, or null if the file is not a valid record file
+ */
+BN::Ref<BN::BinaryView> Load(BN::BinaryView* data) {
+  const BN::DataBuffer raw = data->ReadBuffer(0, data->GetLength());
+  const std::string_view text(static_cast<const char*>(raw.GetData()),
+                              raw.GetLength());
+
+  std::vector<MemorySegment> segments;
+  uint32_t entry = NO_ENTRY;
+  const bool parsed = LooksLikeSRecords(text)
+                          ? ParseSRecords(text, segments, &entry)
+                          : ParseIntelHex(text, segments, &entry);
+  if (!parsed || segments.empty()) {
+    BN::LogError("HCS08: not a valid S-record or Intel HEX file");
+    return nullptr;
+  }
+
+  size_t total = 0;
+  for (const MemorySegment& segment : segments) {
+    total += segment.data.size();
+  }
+  BN::DataBuffer packed(total);
+  std::vector<HexImageView::Placement> placements;
+  placements.reserve(segments.size());
+  uint64_t offset = 0;
+  for (const MemorySegment& segment : segments) {
+    std::memcpy(static_cast<uint8_t*>(packed.GetData()) + offset,
+                segment.data.data(), segment.data.size());
+    placements.push_back({segment.address, offset, segment.data.size()});
+    offset += segment.data.size();
+  }
+
+  const uint64_t start =
+      FindEntryPoint(segments, entry == NO_ENTRY ? nullptr : &entry);
+  BN::Ref<BN::BinaryView> image = new BN::BinaryData(data->GetFile(), packed);
+  return new HexImageView(image, std::move(placements), start,
+                          ReadVectorTable(segments));
+}
+}  // namespace
+
+HexImageView::HexImageView(BN::BinaryView* image,
+                           std::vector<Placement> placements,
+                           const uint64_t entry,
+                           std::vector<InterruptVector> vectors)
+    : BN::BinaryView(VIEW_NAME, image->GetFile(), image),
+      PLACEMENTS(std::move(placements)),
+      ENTRY(entry),
+      VECTORS(std::move(vectors)) {}
+
+/**
+ * Init - Map each segment at its load address, then queue the entry point and
+ * the handler of every interrupt vector
+ * @return false if the hcs08 architecture is not registered
+ */
+bool HexImageView::Init() {
+  const BN::Ref<BN::Architecture> arch = BN::Architecture::GetByName("hcs08");
+  if (!arch) {
+    BN::LogError("HCS08: architecture not registered");
+    return false;
+  }
+  BN::Ref<BN::Platform> platform = BN::Platform::GetByName("hcs08");
+  if (!platform) {
+    platform = arch->GetStandalonePlatform();
+  }
+  SetDefaultArchitecture(arch);
+  SetDefaultPlatform(platform);
+
+  // Record files carry flash contents, so everything is read-only code or
+  // constant data as far as the file can tell
+  for (const Placement& placement : PLACEMENTS) {
+    AddAutoSegment(placement.address, placement.length, placement.offset,
+                   placement.length, SegmentReadable | SegmentExecutable);
+  }
+  AddEntryPointForAnalysis(platform, ENTRY);
+  DefineVectorFunctions(*this, platform, VECTORS);
+  return true;
+}
+
+uint64_t HexImageView::PerformGetEntryPoint() const { return ENTRY; }
+
+bool HexImageView::PerformIsExecutable() const { return true; }
+
+BNEndianness HexImageView::PerformGetDefaultEndianness() const {
+  return BigEndian;
+}
+
+size_t HexImageView::PerformGetAddressSize() const { return Sizes::WORD; }
+
+HexImageViewType::HexImageViewType()
+    : BN::BinaryViewType(VIEW_NAME, VIEW_LONG_NAME) {}
+
+BN::Ref<BN::BinaryView> HexImageViewType::Create(BN::BinaryView* data) {
+  return Load(data);
+}
+
+BN::Ref<BN::BinaryView> HexImageViewType::Parse(BN::BinaryView* data) {
+  return Load(data);
+}
+
+bool HexImageViewType::IsTypeValidForData(BN::BinaryView* data) {
+  const BN::DataBuffer head = data->ReadBuffer(
+      0, std::min<uint64_t>(data->GetLength(), SNIFF_BYTES));
+  const std::string_view text(static_cast<const char*>(head.GetData()),
+                              head.GetLength());
+  return LooksLikeSRecords(text) || LooksLikeIntelHex(text);
+}
+
+bool HexImageViewType::IsDeprecated() { return false; }
+
+/**
+ * ReadVectorTable - Collect the programmed vectors of any view whose handlers
+ * are mapped, for views not loaded by HexImageView
+ * @param view - view with the vector table mapped at its usual address
+ * @return one entry per usable vector, reset first
+ */
+std::vector<InterruptVector> ReadVectorTable(BN::BinaryView& view) {
+  std::vector<InterruptVector> vectors;
+  for (uint32_t slot = RESET_VECTOR; slot >= VECTOR_TABLE_START; slot -= 2) {
+    uint8_t bytes[Sizes::WORD];
+    if (view.Read(bytes, slot, sizeof(bytes)) != sizeof(bytes)) {
+      continue;
+    }
+    const auto handler = static_cast<uint16_t>(bytes[0] << 8 | bytes[1]);
+    if (IsProgrammedVector(handler) && view.IsValidOffset(handler)) {
+      vectors.push_back({static_cast<uint16_t>(slot), handler,
+                         VectorName(static_cast<uint16_t>(slot))});
+    }
+  }
+  return vectors;
+}
+
+/**
+ * DefineVectorFunctions - Name every vector table entry and its handler and
+ * queue the handlers for analysis, as one batch of symbol changes. Handlers
+ * shared by several vectors take the name of the lowest-numbered one, and
+ * interrupt handlers get the interrupt calling convention.
+ * @param view     - view to annotate
+ * @param platform - platform of the handlers
+ * @param vectors  - vectors from ReadVectorTable
+ */
+void DefineVectorFunctions(BN::BinaryView& view, BN::Platform* platform,
+                           const std::vector<InterruptVector>& vectors) {
+  // Absent when the view's platform is not hcs08
+  const BN::Ref<BN::CallingConvention> interrupt =
+      platform->GetArchitecture()->GetCallingConventionByName(
+          InterruptCallingConvention::NAME);
+  view.BeginBulkModifySymbols();
+  for (const InterruptVector& vector : vectors) {
+    view.DefineAutoSymbol(
+        new BN::Symbol(DataSymbol, vector.name + "_vector", vector.slot));
+  }
+  for (const VectorHandler& handler : CollectHandlers(vectors)) {
+    view.DefineAutoSymbol(
+        new BN::Symbol(FunctionSymbol, handler.name, handler.address));
+    const BN::Ref<BN::Function> function =
+        view.AddFunctionForAnalysis(platform, handler.address);
+    if (handler.interrupt && function && interrupt) {
+      function->SetAutoCallingConvention(interrupt);
+    }
+  }
+  view.EndBulkModifySymbols();
+}
+
+/**
+ * ApplyTraceCoverage - Highlight every basic block a trace executed, shaded
+ * from blue (run once) to red (run most) on a log scale. A block's runs are
+ * the steps at its first instruction, so long blocks are not shaded hotter
+ * than short ones run as often; a block only entered past its start counts
+ * as run once. The trace is summed per block first, then all highlights are
+ * set in one undo action.
+ * @param view     - view whose functions to highlight
+ * @param coverage - per-address counts from CountTraceHits
+ * @param result   - set to the steps in each block and the steps outside them
+ * @return number of blocks highlighted
+ */
+size_t ApplyTraceCoverage(BN::BinaryView& view, const TraceCoverage& coverage,
+                          IntervalHits& result) {
+  std::vector<BN::Ref<BN::BasicBlock>> blocks;
+  std::vector<Interval> intervals;
+  for (const BN::Ref<BN::Function>& function :
+       view.GetAnalysisFunctionList()) {
+    for (const BN::Ref<BN::BasicBlock>& block : function->GetBasicBlocks()) {
+      intervals.push_back({block->GetStart(), block->GetEnd(), blocks.size()});
+      blocks.push_back(block);
+    }
+  }
+  SumIntervalHits(IntervalIndex(std::move(intervals)), blocks.size(),
+                  coverage, result);
+
+  std::vector<uint64_t> runs(blocks.size(), 0);
+  uint64_t hottest = 1;
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (result.hits[i] == 0) {
+      continue;
+    }
+    const uint64_t start = blocks[i]->GetStart();
+    runs[i] = std::max<uint64_t>(
+        start < coverage.hits.size() ? coverage.hits[start] : 0, 1);
+    hottest = std::max(hottest, runs[i]);
+  }
+  size_t highlighted = 0;
+  const std::string undo = view.BeginUndoActions();
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (runs[i] == 0) {
+      continue;
+    }
+    BNHighlightColor color{};
+    color.style = MixedHighlightColor;
+    color.color = BlueHighlightColor;
+    color.mixColor = RedHighlightColor;
+    color.mix = static_cast<uint8_t>(
+        std::lround(255 * std::log2(static_cast<double>(runs[i])) /
+                    std::max(1.0, std::log2(static_cast<double>(hottest)))));
+    color.alpha = 255;
+    blocks[i]->SetUserBasicBlockHighlight(color);
+    highlighted++;
+  }
+  view.CommitUndoActions(undo);
+  return highlighted;
+}
+}  // namespace HCS08
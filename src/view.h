@@ -0,0 +1,67 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef HCS08_VIEW_H
+#define HCS08_VIEW_H
+
+#include <binaryninjaapi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coverage.h"
+#include "trace.h"
+#include "vectors.h"
+
+namespace BN = BinaryNinja;
+
+namespace HCS08 {
+/*
+ * Firmware loaded from a Motorola S-record or Intel HEX file. The records are
+ * parsed once when the view is created; their data is packed into an
+ * in-memory parent view, and each contiguous run of records becomes a segment
+ * at its load address.
+ */
+class HexImageView : public BN::BinaryView {
+ public:
+  // Where a loaded segment lives in the packed parent view
+  struct Placement {
+    uint64_t address;
+    uint64_t offset;
+    uint64_t length;
+  };
+
+  HexImageView(BN::BinaryView* image, std::vector<Placement> placements,
+               uint64_t entry, std::vector<InterruptVector> vectors);
+
+  bool Init() override;
+  uint64_t PerformGetEntryPoint() const override;
+  bool PerformIsExecutable() const override;
+  BNEndianness PerformGetDefaultEndianness() const override;
+  size_t PerformGetAddressSize() const override;
+
+ private:
+  std::vector<Placement> PLACEMENTS;
+  uint64_t ENTRY;
+  std::vector<InterruptVector> VECTORS;
+};
+
+class HexImageViewType : public BN::BinaryViewType {
+ public:
+  HexImageViewType();
+
+  BN::Ref<BN::BinaryView> Create(BN::BinaryView* data) override;
+  BN::Ref<BN::BinaryView> Parse(BN::BinaryView* data) override;
+  bool IsTypeValidForData(BN::BinaryView* data) override;
+  bool IsDeprecated() override;
+};
+
+std::vector<InterruptVector> ReadVectorTable(BN::BinaryView& view);
+void DefineVectorFunctions(BN::BinaryView& view, BN::Platform* platform,
+                           const std::vector<InterruptVector>& vectors);
+size_t ApplyTraceCoverage(BN::BinaryView& view, const TraceCoverage& coverage,
+                          IntervalHits& result);
+}  // namespace HCS08
+
+#endif  // HCS08_VIEW_H